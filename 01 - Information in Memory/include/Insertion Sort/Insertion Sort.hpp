@@ -1,4 +1,7 @@
 #pragma once
+#include <concepts>
+#include <cstdint>
+#include <string>
 #include <vector>
 
 template<typename T>
@@ -10,8 +13,56 @@ template<typename T>
  * 类型安全机制
  *
  */
- 
+
 requires std::totally_ordered<T>
 void InsertionSort(std::vector<T>& A);
 
-#include "Insertion Sort.tpp"
\ No newline at end of file
+/*
+ * 间接排序（适合体积大、但能提取出廉价键的 T，例如 200 字节的记录）：
+ * 1. 为每个元素提取 64 位的键前缀，与下标一起放入连续的小数组（每对 16 字节）
+ * 2. 只对这个小数组排序：较短时用插入排序，较长时用按字节的 LSD 基数排序，
+ *    每一趟都是顺序读写，对缓存友好；键前缀相同的一段再按完整的 T 比较（只移动下标）
+ * 3. 最后按排好的下标顺序原地重排 A：沿着置换的每个环依次移动，每个元素只移动一次
+ * 排序是稳定的
+ *
+ * 键前缀必须与 T 的顺序一致：a < b 时 key(a) <= key(b)
+ */
+
+// 常见类型的键前缀：整数按值（有符号数翻转符号位），std::string 取前 8 个字节（按大端拼接）
+template<typename T>
+struct SortKey;
+
+template<std::unsigned_integral T>
+struct SortKey<T> {
+    static uint64_t Of(const T& value) { return static_cast<uint64_t>(value); }
+};
+
+template<std::signed_integral T>
+struct SortKey<T> {
+    static uint64_t Of(const T& value) {
+        return static_cast<uint64_t>(static_cast<int64_t>(value)) ^ (uint64_t{1} << 63);
+    }
+};
+
+template<>
+struct SortKey<std::string> {
+    static uint64_t Of(const std::string& value) {
+        uint64_t key = 0;
+        for (size_t i = 0; i < 8; ++i) {
+            uint64_t byte = i < value.size() ? static_cast<unsigned char>(value[i]) : 0;
+            key = (key << 8) | byte;
+        }
+        return key;
+    }
+};
+
+template<typename T, typename KeyFn>
+requires std::totally_ordered<T> && std::invocable<KeyFn&, const T&> &&
+         std::convertible_to<std::invoke_result_t<KeyFn&, const T&>, uint64_t>
+void IndirectSort(std::vector<T>& A, KeyFn key);
+
+template<typename T>
+requires std::totally_ordered<T> && requires(const T& value) { { SortKey<T>::Of(value) } -> std::same_as<uint64_t>; }
+void IndirectSort(std::vector<T>& A);
+
+#include "Insertion Sort.tpp"
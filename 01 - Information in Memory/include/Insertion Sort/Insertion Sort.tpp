@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <concepts>
+#include <cstdint>
+#include <utility>
 
 template<typename T>
 requires std::totally_ordered<T>
@@ -20,3 +23,125 @@ void InsertionSort(std::vector<T> &A) {
         i = i + 1;
     }
 }
+
+// 间接排序中的一对：键前缀与元素在原数组中的下标
+struct SortKeyIndex {
+    uint64_t key;
+    size_t index;
+};
+
+// 元素较少时直接按键前缀插入排序（移动的只是 16 字节的一对）
+inline void InsertionSortByKey(std::vector<SortKeyIndex> &pairs) {
+    size_t N = pairs.size();
+    size_t i = 1;
+
+    while (i < N) {
+        SortKeyIndex current = pairs[i];
+        size_t j = i;
+
+        while (j > 0 && pairs[j - 1].key > current.key) {
+            pairs[j] = pairs[j - 1];
+            j = j - 1;
+        }
+        pairs[j] = current;
+        i = i + 1;
+    }
+}
+
+// 按字节的 LSD 基数排序（稳定）：一次遍历统计全部 8 个字节的分布，所有键在某个字节上都相同时跳过这一趟
+inline void RadixSortByKey(std::vector<SortKeyIndex> &pairs) {
+    constexpr size_t DIGITS = sizeof(uint64_t);
+    constexpr size_t BUCKETS = 256;
+
+    size_t N = pairs.size();
+    std::vector<size_t> counts(DIGITS * BUCKETS, 0);
+    for (const SortKeyIndex &pair: pairs) {
+        for (size_t d = 0; d < DIGITS; ++d)
+            counts[d * BUCKETS + ((pair.key >> (8 * d)) & 0xFF)] += 1;
+    }
+
+    std::vector<SortKeyIndex> buffer(N);
+    for (size_t d = 0; d < DIGITS; ++d) {
+        size_t *count = counts.data() + d * BUCKETS;
+        if (count[(pairs[0].key >> (8 * d)) & 0xFF] == N)
+            continue;
+
+        // 计数转换为每个桶的起始位置
+        size_t offset = 0;
+        for (size_t b = 0; b < BUCKETS; ++b) {
+            size_t c = count[b];
+            count[b] = offset;
+            offset = offset + c;
+        }
+
+        for (const SortKeyIndex &pair: pairs)
+            buffer[count[(pair.key >> (8 * d)) & 0xFF]++] = pair;
+        pairs.swap(buffer);
+    }
+}
+
+// 按 pairs 中的下标原地重排 A：位置 i 应放原来的 A[pairs[i].index]，每个环只需一个临时对象
+template<typename T>
+void ApplyPermutation(std::vector<T> &A, std::vector<SortKeyIndex> &pairs) {
+    size_t N = A.size();
+
+    for (size_t i = 0; i < N; ++i) {
+        if (pairs[i].index == i)
+            continue;
+
+        T temp = std::move(A[i]);
+        size_t j = i;
+        while (pairs[j].index != i) {
+            size_t next = pairs[j].index;
+            A[j] = std::move(A[next]);
+            pairs[j].index = j;
+            j = next;
+        }
+        A[j] = std::move(temp);
+        pairs[j].index = j;
+    }
+}
+
+template<typename T, typename KeyFn>
+requires std::totally_ordered<T> && std::invocable<KeyFn&, const T&> &&
+         std::convertible_to<std::invoke_result_t<KeyFn&, const T&>, uint64_t>
+void IndirectSort(std::vector<T> &A, KeyFn key) {
+    constexpr size_t RADIX_THRESHOLD = 64;
+    size_t N = A.size();
+    if (N < 2)
+        return;
+
+    // 1. 提取键前缀与下标
+    std::vector<SortKeyIndex> pairs(N);
+    for (size_t i = 0; i < N; ++i)
+        pairs[i] = SortKeyIndex{static_cast<uint64_t>(key(A[i])), i};
+
+    // 2. 按键前缀排序
+    if (N < RADIX_THRESHOLD)
+        InsertionSortByKey(pairs);
+    else
+        RadixSortByKey(pairs);
+
+    // 3. 键前缀相同的一段按完整的元素比较，移动的仍然只是下标
+    size_t begin = 0;
+    while (begin < N) {
+        size_t end = begin + 1;
+        while (end < N && pairs[end].key == pairs[begin].key)
+            end = end + 1;
+
+        if (end - begin > 1) {
+            std::stable_sort(pairs.begin() + begin, pairs.begin() + end,
+                             [&A](const SortKeyIndex &a, const SortKeyIndex &b) { return A[a.index] < A[b.index]; });
+        }
+        begin = end;
+    }
+
+    // 4. 每个元素只移动一次
+    ApplyPermutation(A, pairs);
+}
+
+template<typename T>
+requires std::totally_ordered<T> && requires(const T& value) { { SortKey<T>::Of(value) } -> std::same_as<uint64_t>; }
+void IndirectSort(std::vector<T> &A) {
+    IndirectSort(A, [](const T &value) { return SortKey<T>::Of(value); });
+}
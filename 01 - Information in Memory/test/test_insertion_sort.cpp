@@ -1,4 +1,8 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
 #include <vector>
 #include "Insertion Sort/Insertion Sort.hpp"
 
@@ -16,3 +20,86 @@ TEST(InsertionSortTest, HandlesEmpty) {
     InsertionSort(v);
     EXPECT_TRUE(v.empty());
 }
+
+// 体积较大的记录：只按 key 排序，id 用于检查稳定性，并统计移动赋值的次数
+struct HeavyRecord {
+    uint64_t key = 0;
+    int id = 0;
+    char payload[184] = {};
+
+    static inline size_t moves = 0;
+
+    HeavyRecord() = default;
+    HeavyRecord(uint64_t k, int i) : key(k), id(i) {}
+    HeavyRecord(const HeavyRecord &) = default;
+    HeavyRecord(HeavyRecord &&) = default;
+    HeavyRecord &operator=(const HeavyRecord &) = default;
+
+    HeavyRecord &operator=(HeavyRecord &&other) noexcept {
+        moves = moves + 1;
+        key = other.key;
+        id = other.id;
+        std::memcpy(payload, other.payload, sizeof(payload));
+        return *this;
+    }
+
+    bool operator==(const HeavyRecord &other) const { return key == other.key; }
+    auto operator<=>(const HeavyRecord &other) const { return key <=> other.key; }
+};
+
+TEST(IndirectSortTest, HandlesEmptyAndSingle) {
+    std::vector<int> empty{};
+    IndirectSort(empty);
+    EXPECT_TRUE(empty.empty());
+
+    std::vector<int> single{7};
+    IndirectSort(single);
+    EXPECT_EQ(single, std::vector<int>{7});
+}
+
+// 有符号整数：负数排在前面，短数组与长数组（基数排序）两条路径
+TEST(IndirectSortTest, SortsSignedIntegers) {
+    std::mt19937 rng(42);
+    for (size_t n: {10, 1000}) {
+        std::vector<int> v(n);
+        for (int &x: v)
+            x = static_cast<int>(rng()) % 1000;
+
+        std::vector<int> expected = v;
+        std::sort(expected.begin(), expected.end());
+        IndirectSort(v);
+        EXPECT_EQ(v, expected);
+    }
+}
+
+// 字符串的前 8 个字节相同时按完整内容比较
+TEST(IndirectSortTest, BreaksPrefixTiesWithFullCompare) {
+    std::vector<std::string> v{"prefix00-b", "prefix00", "b", "prefix00-a", "", "a", "prefix00-a"};
+    std::vector<std::string> expected = v;
+    std::sort(expected.begin(), expected.end());
+
+    IndirectSort(v);
+    EXPECT_EQ(v, expected);
+}
+
+// 大记录：结果与 stable_sort 一致，且每个位置只被移动赋值一次
+TEST(IndirectSortTest, MovesEachRecordOnce) {
+    std::mt19937 rng(7);
+    for (size_t n: {50, 5000}) {
+        std::vector<HeavyRecord> v;
+        for (size_t i = 0; i < n; ++i)
+            v.emplace_back(rng() % (n / 4), static_cast<int>(i));
+
+        std::vector<HeavyRecord> expected = v;
+        std::stable_sort(expected.begin(), expected.end());
+
+        HeavyRecord::moves = 0;
+        IndirectSort(v, [](const HeavyRecord &r) { return r.key; });
+        EXPECT_LE(HeavyRecord::moves, n);
+
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(v[i].key, expected[i].key);
+            ASSERT_EQ(v[i].id, expected[i].id);
+        }
+    }
+}
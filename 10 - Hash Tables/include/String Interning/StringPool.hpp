@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <vector>
+
+/*
+ * 字符串驻留（String Interning）：
+ * 1. 每个不同的字符串只在池中保存一份副本
+ * 2. 驻留后得到一个稳定的 32 位 ID 和指向池内副本的 string_view
+ * 3. 驻留句柄的相等比较与哈希都只涉及 ID，时间复杂度 O(1)
+ * 4. 只有同一个池产生的句柄之间比较才有意义
+ * 5. ID 非零，0 保留给默认构造的空句柄，它与任何驻留的字符串都不相等
+ * 6. 池按字符串哈希分成若干分片，每个分片有自己的锁、哈希表和字符存储，
+ *    不同字符串的查找落在不同的锁上，不会争用同一个锁字；ID 的低位记录分片，高位是分片内的序号
+ *
+ */
+
+// 前置声明链地址法哈希表，避免与线性探测版本的同名 HashTable 在头文件中冲突
+template<typename K, typename V>
+class HashTable;
+
+class InternedString {
+public:
+    // 无效 ID，默认构造的句柄不指向任何字符串
+    static constexpr uint32_t INVALID_ID = 0;
+
+    InternedString() : id(INVALID_ID), view() {}
+
+    InternedString(uint32_t id, std::string_view view) : id(id), view(view) {}
+
+    uint32_t Id() const noexcept { return id; }
+
+    std::string_view View() const noexcept { return view; }
+
+    bool Valid() const noexcept { return id != INVALID_ID; }
+
+    // 同一个池中 ID 相同即为同一字符串，无需逐字符比较
+    friend bool operator==(InternedString lhs, InternedString rhs) noexcept {
+        return lhs.id == rhs.id;
+    }
+
+private:
+    uint32_t id;
+    std::string_view view;
+};
+
+template<>
+struct std::hash<InternedString> {
+    size_t operator()(InternedString str) const noexcept {
+        return str.Id();
+    }
+};
+
+class StringPool {
+public:
+    explicit StringPool(size_t initial_bins = 1024);
+
+    // 析构函数在 .cpp 中定义，此处 HashTable 仍是不完整类型
+    ~StringPool();
+
+    // 禁用拷贝：句柄中的 string_view 指向本池的内存
+    StringPool(const StringPool &) = delete;
+
+    StringPool &operator=(const StringPool &) = delete;
+
+    // 返回字符串的驻留句柄，不存在时复制一份到池中；
+    // 所在分片的 ID 用尽时抛出 std::length_error
+    InternedString Intern(std::string_view str);
+
+    // 只查找不插入，查找过程不分配内存
+    std::optional<InternedString> Find(std::string_view str) const;
+
+    // 根据 ID 取回字符串内容，ID 不是由本池产生（包括 INVALID_ID）时抛出 std::out_of_range
+    std::string_view Resolve(uint32_t id) const;
+
+    size_t Size() const;
+
+private:
+    static constexpr uint32_t SHARD_BITS = 4;
+    static constexpr uint32_t SHARDS = 1u << SHARD_BITS;
+
+    // 独占缓存行，避免不同分片的锁字之间伪共享
+    struct alignas(64) Shard {
+        // 分片编号，即 ID 的低 SHARD_BITS 位
+        uint32_t index = 0;
+
+        // 读多写少：已驻留字符串的查找只需共享锁，新字符串插入才需独占锁
+        mutable std::shared_mutex mtx;
+
+        // 键是指向 arena 的 string_view，值是 ID
+        std::unique_ptr<HashTable<std::string_view, uint32_t>> table;
+
+        // 分片内序号 -> 字符串视图，下标 0 是占位，保证拼出的 ID 非零
+        std::vector<std::string_view> views;
+
+        // 按块分配的字符存储，块一旦分配就不会移动，保证 string_view 长期有效
+        std::vector<std::unique_ptr<char[]>> blocks;
+        size_t block_used = 0;
+        size_t block_capacity = 0;
+    };
+
+    std::array<Shard, SHARDS> shards;
+
+    // 取哈希值的高位选择分片，分片内的哈希表按低位（取模）分桶，两者互不相关
+    static uint32_t ShardOf(std::string_view str);
+
+    static std::optional<InternedString> FindLocked(const Shard &shard, std::string_view str);
+
+    static std::string_view CopyToArena(Shard &shard, std::string_view str);
+
+    static void Rehash(Shard &shard, size_t new_size);
+};
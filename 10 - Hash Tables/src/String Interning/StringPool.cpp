@@ -0,0 +1,134 @@
+#include "String Interning/StringPool.hpp"
+#include "Chaining/Chaining.hpp"
+
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+
+namespace {
+    // 每个字符块的默认大小，超长字符串单独分配一块
+    constexpr size_t BLOCK_SIZE = 64 * 1024;
+}
+
+StringPool::StringPool(size_t initial_bins) {
+    size_t bins = initial_bins / SHARDS > 0 ? initial_bins / SHARDS : 1;
+    for (uint32_t i = 0; i < SHARDS; i++) {
+        shards[i].index = i;
+        shards[i].table = std::make_unique<HashTable<std::string_view, uint32_t>>(bins);
+        shards[i].views.emplace_back();
+    }
+}
+
+StringPool::~StringPool() = default;
+
+InternedString StringPool::Intern(std::string_view str) {
+    Shard &shard = shards[ShardOf(str)];
+
+    // 快速路径：绝大多数调用驻留的是已知字符串，只需所在分片的共享锁
+    {
+        std::shared_lock lock(shard.mtx);
+        auto found = FindLocked(shard, str);
+        if (found.has_value())
+            return found.value();
+    }
+
+    std::unique_lock lock(shard.mtx);
+
+    // 释放共享锁到获取独占锁之间，其他线程可能已插入同一字符串
+    auto found = FindLocked(shard, str);
+    if (found.has_value())
+        return found.value();
+
+    // 分片内序号用尽时拒绝插入，而不是让 ID 回绕到已有的字符串
+    if (shard.views.size() > (std::numeric_limits<uint32_t>::max() >> SHARD_BITS))
+        throw std::length_error("StringPool: 32-bit string ID space exhausted");
+
+    // 负载因子超过 1 时扩容，保持链表长度为常数
+    if (shard.views.size() - 1 >= shard.table->size)
+        Rehash(shard, shard.table->size * 2);
+
+    auto id = static_cast<uint32_t>(shard.views.size() << SHARD_BITS) | shard.index;
+    std::string_view stored = CopyToArena(shard, str);
+    HashTableInsert(*shard.table, stored, id);
+    shard.views.push_back(stored);
+
+    return {id, stored};
+}
+
+std::optional<InternedString> StringPool::Find(std::string_view str) const {
+    const Shard &shard = shards[ShardOf(str)];
+    std::shared_lock lock(shard.mtx);
+    return FindLocked(shard, str);
+}
+
+std::string_view StringPool::Resolve(uint32_t id) const {
+    if (id == InternedString::INVALID_ID)
+        throw std::out_of_range("StringPool: invalid string ID");
+
+    const Shard &shard = shards[id & (SHARDS - 1)];
+    std::shared_lock lock(shard.mtx);
+    size_t local = id >> SHARD_BITS;
+    if (local == 0)
+        throw std::out_of_range("StringPool: invalid string ID");
+    return shard.views.at(local);
+}
+
+size_t StringPool::Size() const {
+    size_t size = 0;
+    for (const Shard &shard: shards) {
+        std::shared_lock lock(shard.mtx);
+        size = size + shard.views.size() - 1;
+    }
+    return size;
+}
+
+uint32_t StringPool::ShardOf(std::string_view str) {
+    size_t hash = std::hash<std::string_view>{}(str);
+    return static_cast<uint32_t>(hash >> (std::numeric_limits<size_t>::digits - SHARD_BITS));
+}
+
+std::optional<InternedString> StringPool::FindLocked(const Shard &shard, std::string_view str) {
+    auto node = HashTableLookup(*shard.table, str);
+    if (node == nullptr)
+        return std::nullopt;
+
+    return InternedString(node->value, node->key);
+}
+
+std::string_view StringPool::CopyToArena(Shard &shard, std::string_view str) {
+    if (str.empty())
+        return {};
+
+    if (str.size() > BLOCK_SIZE) {
+        // 独立块放在最前面，blocks.back() 始终是当前可写的块
+        auto large = std::make_unique<char[]>(str.size());
+        std::memcpy(large.get(), str.data(), str.size());
+        char *dest = large.get();
+        shard.blocks.insert(shard.blocks.begin(), std::move(large));
+
+        return {dest, str.size()};
+    }
+
+    if (shard.block_capacity - shard.block_used < str.size()) {
+        shard.blocks.push_back(std::make_unique<char[]>(BLOCK_SIZE));
+        shard.block_used = 0;
+        shard.block_capacity = BLOCK_SIZE;
+    }
+
+    char *dest = shard.blocks.back().get() + shard.block_used;
+    std::memcpy(dest, str.data(), str.size());
+    shard.block_used = shard.block_used + str.size();
+
+    return {dest, str.size()};
+}
+
+void StringPool::Rehash(Shard &shard, size_t new_size) {
+    auto bigger = std::make_unique<HashTable<std::string_view, uint32_t>>(new_size);
+
+    // 键本身存放在 arena 中，扩容只需重新插入视图，不复制字符
+    for (size_t local = 1; local < shard.views.size(); local++)
+        HashTableInsert(*bigger, shard.views[local], static_cast<uint32_t>(local << SHARD_BITS) | shard.index);
+
+    shard.table = std::move(bigger);
+}
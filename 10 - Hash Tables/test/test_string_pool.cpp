@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include "../include/String Interning/StringPool.hpp"
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+class StringPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 每个测试前都会运行
+    }
+
+    void TearDown() override {
+        // 每个测试后都会运行
+    }
+
+    // 初始桶数很小，便于触发扩容
+    StringPool pool{4};
+};
+
+// 相同内容得到相同句柄
+TEST_F(StringPoolTest, SameStringSameId) {
+    auto a = pool.Intern("apple");
+    auto b = pool.Intern(std::string("apple"));
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.Id(), b.Id());
+    EXPECT_EQ(a.View(), "apple");
+    EXPECT_EQ(pool.Size(), 1);
+}
+
+// 不同内容得到不同句柄
+TEST_F(StringPoolTest, DifferentStringsDifferentIds) {
+    auto a = pool.Intern("apple");
+    auto b = pool.Intern("banana");
+    EXPECT_FALSE(a == b);
+    EXPECT_EQ(pool.Resolve(a.Id()), "apple");
+    EXPECT_EQ(pool.Resolve(b.Id()), "banana");
+}
+
+// 驻留后的视图不依赖调用方的字符串
+TEST_F(StringPoolTest, ViewOutlivesSource) {
+    InternedString handle;
+    {
+        std::string temp = "temporary_string_value";
+        handle = pool.Intern(temp);
+    }
+    EXPECT_EQ(handle.View(), "temporary_string_value");
+}
+
+// 默认构造的句柄无效，与第一个驻留的字符串也不相等
+TEST_F(StringPoolTest, DefaultHandleIsInvalid) {
+    InternedString none;
+    EXPECT_FALSE(none.Valid());
+
+    auto first = pool.Intern("first");
+    EXPECT_TRUE(first.Valid());
+    EXPECT_NE(first.Id(), InternedString::INVALID_ID);
+    EXPECT_FALSE(none == first);
+    EXPECT_NE(std::hash<InternedString>{}(none), std::hash<InternedString>{}(first));
+    EXPECT_THROW(pool.Resolve(InternedString::INVALID_ID), std::out_of_range);
+}
+
+// Find 不插入新字符串
+TEST_F(StringPoolTest, FindDoesNotInsert) {
+    EXPECT_FALSE(pool.Find("cherry").has_value());
+    EXPECT_EQ(pool.Size(), 0);
+
+    auto c = pool.Intern("cherry");
+    auto found = pool.Find("cherry");
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found.value(), c);
+}
+
+// 空字符串与超长字符串
+TEST_F(StringPoolTest, EmptyAndLargeStrings) {
+    auto empty = pool.Intern("");
+    EXPECT_EQ(pool.Intern(""), empty);
+    EXPECT_TRUE(empty.View().empty());
+
+    std::string large(200 * 1024, 'x');
+    auto big = pool.Intern(large);
+    auto small = pool.Intern("after_large");
+    EXPECT_EQ(big.View(), large);
+    EXPECT_EQ(small.View(), "after_large");
+    EXPECT_EQ(pool.Intern(large), big);
+}
+
+// 扩容后 ID 和视图保持稳定
+TEST_F(StringPoolTest, StableAcrossRehash) {
+    std::vector<InternedString> handles;
+    for (int i = 0; i < 1000; ++i)
+        handles.push_back(pool.Intern("key_" + std::to_string(i)));
+
+    EXPECT_EQ(pool.Size(), 1000);
+    for (int i = 0; i < 1000; ++i) {
+        auto again = pool.Intern("key_" + std::to_string(i));
+        EXPECT_EQ(again, handles[i]);
+        EXPECT_EQ(again.View(), "key_" + std::to_string(i));
+    }
+}
+
+// 字符串分布在不同分片中，ID 仍然两两不同且都能取回内容
+TEST_F(StringPoolTest, UniqueIdsAcrossShards) {
+    std::unordered_set<uint32_t> ids;
+    for (int i = 0; i < 1000; ++i) {
+        auto handle = pool.Intern("shard_" + std::to_string(i));
+        EXPECT_TRUE(handle.Valid());
+        EXPECT_TRUE(ids.insert(handle.Id()).second);
+        EXPECT_EQ(pool.Resolve(handle.Id()), "shard_" + std::to_string(i));
+    }
+
+    // 不是由本池产生的 ID
+    EXPECT_THROW(pool.Resolve(1), std::out_of_range);
+    EXPECT_THROW(pool.Resolve(0xFFFFFFF0u), std::out_of_range);
+}
+
+// 句柄可以直接作为无序容器的键
+TEST_F(StringPoolTest, HashByHandle) {
+    std::unordered_set<InternedString> set;
+    set.insert(pool.Intern("a"));
+    set.insert(pool.Intern("b"));
+    set.insert(pool.Intern("a"));
+    EXPECT_EQ(set.size(), 2);
+}
+
+// 多线程并发驻留重叠的字符串集合
+TEST_F(StringPoolTest, ConcurrentIntern) {
+    const int num_threads = 4;
+    const int num_keys = 2000;
+    std::vector<std::vector<uint32_t>> ids(num_threads, std::vector<uint32_t>(num_keys));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < num_keys; ++i)
+                ids[t][i] = pool.Intern("shared_" + std::to_string(i)).Id();
+        });
+    }
+    for (auto &thread: threads)
+        thread.join();
+
+    EXPECT_EQ(pool.Size(), num_keys);
+    for (int t = 1; t < num_threads; ++t)
+        EXPECT_EQ(ids[t], ids[0]);
+    for (int i = 0; i < num_keys; ++i)
+        EXPECT_EQ(pool.Resolve(ids[0][i]), "shared_" + std::to_string(i));
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+/*
+ * 基准测试共用的访问序列生成器
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Zipf 分布：第 i 个键被访问的概率与 1 / (i + 1)^skew 成正比
+inline std::vector<int> ZipfKeys(size_t key_space, double skew, size_t count, unsigned seed) {
+    std::vector<double> cdf(key_space);
+    double total = 0;
+    for (size_t i = 0; i < key_space; ++i) {
+        total = total + 1.0 / std::pow(static_cast<double>(i + 1), skew);
+        cdf[i] = total;
+    }
+
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> dist(0.0, total);
+
+    // 用一个随机排列打乱热度与键值的对应关系，避免热键恰好是连续的小整数
+    std::vector<int> permutation(key_space);
+    for (size_t i = 0; i < key_space; ++i)
+        permutation[i] = static_cast<int>(i);
+    std::shuffle(permutation.begin(), permutation.end(), rng);
+
+    std::vector<int> keys(count);
+    for (auto &key: keys) {
+        size_t rank = std::lower_bound(cdf.begin(), cdf.end(), dist(rng)) - cdf.begin();
+        key = permutation[std::min(rank, key_space - 1)];
+    }
+    return keys;
+}
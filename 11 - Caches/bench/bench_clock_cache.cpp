@@ -0,0 +1,113 @@
+/*
+ * CLOCK 与 LRU 的对比基准：
+ * 1. 命中率：同一条 Zipf 访问序列分别回放到 IntrusiveLRUCache 和 ClockCache
+ * 2. 吞吐量：多线程下 ClockCache（命中只取读锁）与全局加锁 LRUCache 的对比
+ *
+ */
+
+#include "LRU/LRUCache.hpp"
+#include "LRU/IntrusiveLRUCache.hpp"
+#include "CLOCK/ClockCache.hpp"
+#include "Workload.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+    constexpr size_t CAPACITY = 10000;
+    constexpr size_t KEY_SPACE = 1000000;
+    constexpr double SKEW = 0.9;
+    constexpr size_t OPERATIONS_PER_THREAD = 1000000;
+
+    std::atomic<size_t> misses{0};
+
+    int CountingSource(const int &key) {
+        misses.fetch_add(1, std::memory_order_relaxed);
+        return key * 10;
+    }
+
+    class GlobalLockLRUCache {
+    public:
+        GlobalLockLRUCache(size_t max_sz, std::function<int(const int &)> source)
+            : cache(max_sz, std::move(source)) {
+        }
+
+        int CacheLookup(const int &key) {
+            std::lock_guard lock(mtx);
+            return cache.CacheLookup(key);
+        }
+
+    private:
+        std::mutex mtx;
+        LRUCache<int, int> cache;
+    };
+
+    template<typename Cache>
+    double HitRatio(const std::vector<int> &keys) {
+        Cache cache(CAPACITY, CountingSource);
+        misses = 0;
+        for (int key: keys)
+            cache.CacheLookup(key);
+        return 1.0 - static_cast<double>(misses.load()) / keys.size();
+    }
+
+    template<typename Cache>
+    double Throughput(size_t num_threads) {
+        Cache cache(CAPACITY, CountingSource);
+        std::vector<std::vector<int>> traces;
+        for (size_t t = 0; t < num_threads; ++t)
+            traces.push_back(ZipfKeys(KEY_SPACE, SKEW, OPERATIONS_PER_THREAD, static_cast<unsigned>(t + 1)));
+
+        std::atomic<bool> start{false};
+        std::atomic<long long> sink{0};
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&, t]() {
+                while (!start.load(std::memory_order_acquire))
+                    std::this_thread::yield();
+
+                long long local = 0;
+                for (int key: traces[t])
+                    local = local + cache.CacheLookup(key);
+                sink.fetch_add(local);
+            });
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        start.store(true, std::memory_order_release);
+        for (auto &thread: threads)
+            thread.join();
+        auto end = std::chrono::steady_clock::now();
+
+        double seconds = std::chrono::duration<double>(end - begin).count();
+        return static_cast<double>(num_threads * OPERATIONS_PER_THREAD) / seconds / 1e6;
+    }
+}
+
+int main(int argc, char **argv) {
+    size_t max_threads = std::thread::hardware_concurrency();
+    if (argc > 1)
+        max_threads = std::strtoul(argv[1], nullptr, 10);
+    if (max_threads == 0)
+        max_threads = 1;
+
+    std::printf("capacity = %zu, key space = %zu, zipf skew = %.2f\n", CAPACITY, KEY_SPACE, SKEW);
+
+    auto keys = ZipfKeys(KEY_SPACE, SKEW, OPERATIONS_PER_THREAD * 2, 7);
+    std::printf("hit ratio: LRU %.4f, CLOCK %.4f\n",
+                HitRatio<IntrusiveLRUCache<int, int>>(keys), HitRatio<ClockCache<int, int>>(keys));
+
+    std::printf("%8s %20s %20s\n", "threads", "global lock Mops/s", "CLOCK Mops/s");
+    for (size_t threads = 1; threads <= max_threads; threads = threads * 2) {
+        double global_mops = Throughput<GlobalLockLRUCache>(threads);
+        double clock_mops = Throughput<ClockCache<int, int>>(threads);
+        std::printf("%8zu %20.2f %20.2f\n", threads, global_mops, clock_mops);
+    }
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * 淘汰策略对比基准：同一个 LRUCache 存储，分别使用 LRU、SLRU、ARC 策略回放
+ * 1. Zipf 负载
+ * 2. Zipf 负载中周期性插入一次性扫描
+ * 3. 循环访问：键空间略大于容量，LRU 在这种负载下几乎全部未命中
+ *
+ */
+
+#include "LRU/LRUCache.hpp"
+#include "Policy/SLRUPolicy.hpp"
+#include "Policy/ARCPolicy.hpp"
+#include "Workload.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace {
+    constexpr size_t CAPACITY = 10000;
+    constexpr size_t KEY_SPACE = 1000000;
+    constexpr double SKEW = 0.9;
+    constexpr size_t OPERATIONS = 2000000;
+
+    size_t misses = 0;
+
+    int CountingSource(const int &key) {
+        misses = misses + 1;
+        return key * 10;
+    }
+
+    std::vector<int> WithScans(const std::vector<int> &keys, size_t period, size_t scan_length) {
+        std::vector<int> result;
+        int next_scan_key = static_cast<int>(KEY_SPACE);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            result.push_back(keys[i]);
+            if ((i + 1) % period == 0) {
+                for (size_t j = 0; j < scan_length; ++j)
+                    result.push_back(next_scan_key++);
+            }
+        }
+        return result;
+    }
+
+    std::vector<int> Loop(size_t loop_length, size_t count) {
+        std::vector<int> keys(count);
+        for (size_t i = 0; i < count; ++i)
+            keys[i] = static_cast<int>(i % loop_length);
+        return keys;
+    }
+
+    template<typename Policy>
+    void Run(const char *name, const std::vector<int> &keys) {
+        LRUCache<int, int, Policy> cache(CAPACITY, CountingSource);
+        misses = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int key: keys)
+            cache.CacheLookup(key);
+        auto end = std::chrono::steady_clock::now();
+
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() / keys.size();
+        double hit_ratio = 1.0 - static_cast<double>(misses) / keys.size();
+        std::printf("  %-6s hit ratio %.4f  %6.1f ns/op\n", name, hit_ratio, ns);
+    }
+
+    void Compare(const char *workload, const std::vector<int> &keys) {
+        std::printf("%s (%zu accesses)\n", workload, keys.size());
+        Run<LRUPolicy<int>>("LRU", keys);
+        Run<SLRUPolicy<int>>("SLRU", keys);
+        Run<ARCPolicy<int>>("ARC", keys);
+    }
+}
+
+int main() {
+    std::printf("capacity = %zu, key space = %zu, zipf skew = %.2f\n", CAPACITY, KEY_SPACE, SKEW);
+
+    auto zipf = ZipfKeys(KEY_SPACE, SKEW, OPERATIONS, 11);
+    Compare("zipf", zipf);
+    Compare("zipf + scans", WithScans(zipf, 100000, 50000));
+    Compare("loop", Loop(CAPACITY * 5 / 4, OPERATIONS));
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * LRUCache 与 IntrusiveLRUCache 的对比基准：
+ * 1. 全命中负载：测量命中路径的耗时与内存分配次数
+ * 2. 混合负载：键空间是容量的两倍，约一半访问未命中
+ * 3. 每个条目的堆内存：填满缓存后统计分配的字节数
+ * 4. LRUCache+stats：启用 CacheStats 后的开销
+ *
+ */
+
+#include "LRU/LRUCache.hpp"
+#include "LRU/IntrusiveLRUCache.hpp"
+#include "Stats/CacheStats.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+namespace {
+    size_t allocation_count = 0;
+    size_t allocation_bytes = 0;
+}
+
+// 替换全局 operator new，统计分配次数与字节数
+void *operator new(size_t size) {
+    allocation_count = allocation_count + 1;
+    allocation_bytes = allocation_bytes + size;
+    if (void *ptr = std::malloc(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+    constexpr size_t CAPACITY = 100000;
+    constexpr size_t OPERATIONS = 5000000;
+
+    int SlowDataSource(const int &key) {
+        return key * 10;
+    }
+
+    std::vector<int> MakeKeys(size_t key_space) {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int> dist(0, static_cast<int>(key_space) - 1);
+        std::vector<int> keys(OPERATIONS);
+        for (auto &key: keys)
+            key = dist(rng);
+        return keys;
+    }
+
+    template<typename Cache>
+    void Run(const char *name, const char *workload, size_t key_space) {
+        // 预热：填满缓存，同时统计每个条目的内存开销（含桶数组）
+        size_t bytes_before = allocation_bytes;
+        Cache cache(CAPACITY, SlowDataSource);
+        for (size_t i = 0; i < CAPACITY; ++i)
+            cache.CacheLookup(static_cast<int>(i));
+        double bytes_per_entry = static_cast<double>(allocation_bytes - bytes_before) / CAPACITY;
+
+        auto keys = MakeKeys(key_space);
+        long long checksum = 0;
+
+        size_t count_before = allocation_count;
+        auto start = std::chrono::steady_clock::now();
+        for (int key: keys)
+            checksum = checksum + cache.CacheLookup(key);
+        auto end = std::chrono::steady_clock::now();
+        size_t allocations = allocation_count - count_before;
+
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() / OPERATIONS;
+        std::printf("%-20s %-8s %8.1f ns/op %10.3f allocs/op %8.1f B/entry (checksum %lld)\n",
+                    name, workload, ns, static_cast<double>(allocations) / OPERATIONS, bytes_per_entry, checksum);
+    }
+}
+
+int main() {
+    std::printf("capacity = %zu, operations = %zu\n", CAPACITY, OPERATIONS);
+
+    using StatsCache = LRUCache<int, int, LRUPolicy<int>, CacheStats>;
+
+    Run<LRUCache<int, int>>("LRUCache", "hit", CAPACITY);
+    Run<StatsCache>("LRUCache+stats", "hit", CAPACITY);
+    Run<IntrusiveLRUCache<int, int>>("IntrusiveLRUCache", "hit", CAPACITY);
+
+    Run<LRUCache<int, int>>("LRUCache", "mixed", CAPACITY * 2);
+    Run<StatsCache>("LRUCache+stats", "mixed", CAPACITY * 2);
+    Run<IntrusiveLRUCache<int, int>>("IntrusiveLRUCache", "mixed", CAPACITY * 2);
+
+    return 0;
+}
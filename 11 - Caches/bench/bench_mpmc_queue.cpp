@@ -0,0 +1,161 @@
+/*
+ * 多生产者多消费者队列吞吐量基准：
+ * 1. 链表 Queue 外加一把互斥锁，每次入队一次 new、每次出队一次 delete
+ * 2. BoundedMPMCQueue，单个入队/出队
+ * 3. BoundedMPMCQueue，每次批量处理 16 个
+ * 生产者、消费者各 P 个，P 从 1 倍增到 N（默认取硬件线程数的一半，可通过第一个命令行参数指定）
+ *
+ */
+
+#include "Queue/queue.hpp"
+#include "Queue/BoundedMPMCQueue.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace {
+    constexpr size_t ITEMS_PER_PRODUCER = 1000000;
+    constexpr size_t RING_CAPACITY = 1024;
+    constexpr size_t BATCH = 16;
+
+    // 原有的链表队列，所有线程共享一把锁
+    class LockedLinkedQueue {
+    public:
+        void Push(int value) {
+            std::lock_guard lock(mtx);
+            Enqueue(q, value);
+        }
+
+        size_t TryPop(int *out, size_t) {
+            std::lock_guard lock(mtx);
+            std::optional<int> value = Dequeue(q);
+            if (!value.has_value())
+                return 0;
+            out[0] = value.value();
+            return 1;
+        }
+
+    private:
+        std::mutex mtx;
+        Queue<int> q;
+    };
+
+    class RingQueue {
+    public:
+        RingQueue() : queue(RING_CAPACITY) {}
+
+        void Push(int value) { queue.Enqueue(value); }
+
+        size_t TryPop(int *out, size_t) {
+            std::optional<int> value = queue.TryDequeue();
+            if (!value.has_value())
+                return 0;
+            out[0] = value.value();
+            return 1;
+        }
+
+    private:
+        BoundedMPMCQueue<int> queue;
+    };
+
+    // 生产者攒够一批再入队，消费者一次最多取一批
+    class BatchedRingQueue {
+    public:
+        BatchedRingQueue() : queue(RING_CAPACITY) {}
+
+        void PushBatch(std::span<const int> values) { queue.EnqueueBatch(values); }
+
+        size_t TryPop(int *out, size_t max) { return queue.TryDequeueBatch(std::span<int>(out, max)); }
+
+    private:
+        BoundedMPMCQueue<int> queue;
+    };
+
+    template<typename Q>
+    void Produce(Q &queue, int base) {
+        if constexpr (requires { queue.PushBatch(std::span<const int>()); }) {
+            int batch[BATCH];
+            for (size_t i = 0; i < ITEMS_PER_PRODUCER; i += BATCH) {
+                for (size_t j = 0; j < BATCH; ++j)
+                    batch[j] = base + static_cast<int>(i + j);
+                queue.PushBatch(std::span<const int>(batch, BATCH));
+            }
+        } else {
+            for (size_t i = 0; i < ITEMS_PER_PRODUCER; ++i)
+                queue.Push(base + static_cast<int>(i));
+        }
+    }
+
+    template<typename Q>
+    double Throughput(size_t pairs) {
+        Q queue;
+        size_t total = pairs * ITEMS_PER_PRODUCER;
+        std::atomic<bool> start{false};
+        std::atomic<size_t> consumed{0};
+        std::atomic<long long> sink{0};
+
+        std::vector<std::thread> threads;
+        for (size_t p = 0; p < pairs; ++p) {
+            threads.emplace_back([&, p]() {
+                while (!start.load(std::memory_order_acquire))
+                    std::this_thread::yield();
+                Produce(queue, static_cast<int>(p * ITEMS_PER_PRODUCER));
+            });
+
+            threads.emplace_back([&]() {
+                while (!start.load(std::memory_order_acquire))
+                    std::this_thread::yield();
+
+                int out[BATCH];
+                long long local = 0;
+                while (consumed.load(std::memory_order_relaxed) < total) {
+                    size_t count = queue.TryPop(out, BATCH);
+                    if (count == 0) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    for (size_t i = 0; i < count; ++i)
+                        local = local + out[i];
+                    consumed.fetch_add(count, std::memory_order_relaxed);
+                }
+                sink.fetch_add(local);
+            });
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        start.store(true, std::memory_order_release);
+        for (auto &thread: threads)
+            thread.join();
+        auto end = std::chrono::steady_clock::now();
+
+        double seconds = std::chrono::duration<double>(end - begin).count();
+        return static_cast<double>(total) / seconds / 1e6;
+    }
+}
+
+int main(int argc, char **argv) {
+    size_t max_pairs = std::thread::hardware_concurrency() / 2;
+    if (argc > 1)
+        max_pairs = std::strtoul(argv[1], nullptr, 10);
+    if (max_pairs == 0)
+        max_pairs = 1;
+
+    std::printf("items/producer = %zu, ring capacity = %zu, batch = %zu\n",
+                ITEMS_PER_PRODUCER, RING_CAPACITY, BATCH);
+    std::printf("%8s %18s %18s %18s\n", "pairs", "locked list Mops/s", "ring Mops/s", "ring batch Mops/s");
+
+    for (size_t pairs = 1; pairs <= max_pairs; pairs = pairs * 2) {
+        double locked = Throughput<LockedLinkedQueue>(pairs);
+        double ring = Throughput<RingQueue>(pairs);
+        double batched = Throughput<BatchedRingQueue>(pairs);
+        std::printf("%8zu %18.2f %18.2f %18.2f\n", pairs, locked, ring, batched);
+    }
+
+    return 0;
+}
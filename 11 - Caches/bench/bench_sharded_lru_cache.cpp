@@ -0,0 +1,102 @@
+/*
+ * 多线程吞吐量基准：
+ * 1. LRUCache 外加一把全局互斥锁（原有用法）
+ * 2. ShardedLRUCache，每个分片独立加锁
+ * 线程数从 1 开始倍增到 N（默认取硬件线程数，可通过第一个命令行参数指定）
+ *
+ */
+
+#include "LRU/LRUCache.hpp"
+#include "LRU/ShardedLRUCache.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+    constexpr size_t CAPACITY = 100000;
+    constexpr size_t KEY_SPACE = CAPACITY * 5 / 4;
+    constexpr size_t OPERATIONS_PER_THREAD = 1000000;
+
+    int SlowDataSource(const int &key) {
+        return key * 10;
+    }
+
+    // 原有用法：所有线程共享一把锁
+    class GlobalLockLRUCache {
+    public:
+        GlobalLockLRUCache(size_t max_sz, std::function<int(const int &)> source)
+            : cache(max_sz, std::move(source)) {
+        }
+
+        int CacheLookup(const int &key) {
+            std::lock_guard lock(mtx);
+            return cache.CacheLookup(key);
+        }
+
+    private:
+        std::mutex mtx;
+        LRUCache<int, int> cache;
+    };
+
+    template<typename Cache>
+    double Throughput(Cache &cache, size_t num_threads) {
+        std::atomic<bool> start{false};
+        std::atomic<long long> sink{0};
+
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&, t]() {
+                std::mt19937 rng(static_cast<unsigned>(t + 1));
+                std::uniform_int_distribution<int> dist(0, static_cast<int>(KEY_SPACE) - 1);
+                std::vector<int> keys(OPERATIONS_PER_THREAD);
+                for (auto &key: keys)
+                    key = dist(rng);
+
+                while (!start.load(std::memory_order_acquire))
+                    std::this_thread::yield();
+
+                long long local = 0;
+                for (int key: keys)
+                    local = local + cache.CacheLookup(key);
+                sink.fetch_add(local);
+            });
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        start.store(true, std::memory_order_release);
+        for (auto &thread: threads)
+            thread.join();
+        auto end = std::chrono::steady_clock::now();
+
+        double seconds = std::chrono::duration<double>(end - begin).count();
+        return static_cast<double>(num_threads * OPERATIONS_PER_THREAD) / seconds / 1e6;
+    }
+}
+
+int main(int argc, char **argv) {
+    size_t max_threads = std::thread::hardware_concurrency();
+    if (argc > 1)
+        max_threads = std::strtoul(argv[1], nullptr, 10);
+    if (max_threads == 0)
+        max_threads = 1;
+
+    std::printf("capacity = %zu, key space = %zu, ops/thread = %zu\n", CAPACITY, KEY_SPACE, OPERATIONS_PER_THREAD);
+    std::printf("%8s %20s %20s\n", "threads", "global lock Mops/s", "sharded Mops/s");
+
+    for (size_t threads = 1; threads <= max_threads; threads = threads * 2) {
+        GlobalLockLRUCache global(CAPACITY, SlowDataSource);
+        ShardedLRUCache<int, int> sharded(CAPACITY, SlowDataSource, 64);
+
+        double global_mops = Throughput(global, threads);
+        double sharded_mops = Throughput(sharded, threads);
+        std::printf("%8zu %20.2f %20.2f\n", threads, global_mops, sharded_mops);
+    }
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+ * W-TinyLFU 与 LRU、CLOCK 的命中率对比：
+ * 1. 纯 Zipf 负载
+ * 2. Zipf 负载中周期性插入大范围的一次性扫描
+ *
+ */
+
+#include "LRU/IntrusiveLRUCache.hpp"
+#include "CLOCK/ClockCache.hpp"
+#include "TinyLFU/TinyLFUCache.hpp"
+#include "Workload.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace {
+    constexpr size_t CAPACITY = 10000;
+    constexpr size_t KEY_SPACE = 1000000;
+    constexpr double SKEW = 0.9;
+    constexpr size_t OPERATIONS = 2000000;
+
+    size_t misses = 0;
+
+    int CountingSource(const int &key) {
+        misses = misses + 1;
+        return key * 10;
+    }
+
+    // 每访问 period 次，插入一段长度为 scan_length 的从未出现过的连续键
+    std::vector<int> WithScans(const std::vector<int> &keys, size_t period, size_t scan_length) {
+        std::vector<int> result;
+        int next_scan_key = static_cast<int>(KEY_SPACE);
+        for (size_t i = 0; i < keys.size(); ++i) {
+            result.push_back(keys[i]);
+            if ((i + 1) % period == 0) {
+                for (size_t j = 0; j < scan_length; ++j)
+                    result.push_back(next_scan_key++);
+            }
+        }
+        return result;
+    }
+
+    template<typename Cache>
+    void Run(const char *name, const std::vector<int> &keys) {
+        Cache cache(CAPACITY, CountingSource);
+        misses = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int key: keys)
+            cache.CacheLookup(key);
+        auto end = std::chrono::steady_clock::now();
+
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() / keys.size();
+        double hit_ratio = 1.0 - static_cast<double>(misses) / keys.size();
+        std::printf("  %-12s hit ratio %.4f  %6.1f ns/op\n", name, hit_ratio, ns);
+    }
+
+    void Compare(const char *workload, const std::vector<int> &keys) {
+        std::printf("%s (%zu accesses)\n", workload, keys.size());
+        Run<IntrusiveLRUCache<int, int>>("LRU", keys);
+        Run<ClockCache<int, int>>("CLOCK", keys);
+        Run<TinyLFUCache<int, int>>("W-TinyLFU", keys);
+    }
+}
+
+int main() {
+    std::printf("capacity = %zu, key space = %zu, zipf skew = %.2f\n", CAPACITY, KEY_SPACE, SKEW);
+
+    auto zipf = ZipfKeys(KEY_SPACE, SKEW, OPERATIONS, 11);
+    Compare("zipf", zipf);
+    Compare("zipf + scans", WithScans(zipf, 100000, 50000));
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "ThreadPool.hpp"
+#include "../LRU/IntrusiveLRUCache.hpp"
+
+/*
+ * 异步加载的 LRU 缓存：
+ * 1. AsyncCacheLookup 立即返回 shared_future：命中时是已就绪的结果，
+ *    未命中时在执行器上加载，调用线程（例如事件循环线程）从不阻塞在数据源上
+ * 2. 数据源有两种形式：
+ *    - 返回 std::future<V>：在执行器线程上等待 future，等待期间占用该线程，实际并发的加载数是
+ *      min(max_in_flight, 执行器线程数)；若 future 要由同一个执行器上的任务完成，线程全部阻塞时会死锁
+ *    - 回调式：发起加载后立即返回，完成时调用 done 或 fail（可以在任意线程上），执行器线程不等待，
+ *      适合本身就是回调式的异步客户端，也没有上面的死锁
+ * 3. 同一个键的并发未命中共享同一次加载；加载失败的异常传给所有等待者且不被缓存；
+ *    查找的结果可以通过 shared_future 取得，也可以注册回调，加载完成时直接调用，不必有线程等在 future 上
+ * 4. 同时进行的加载数不超过 max_in_flight，多出的请求排队等待空位
+ * 5. 提前刷新：条目加载后超过 refresh_after 时，命中仍立即返回旧值，
+ *    同时在后台重新加载；刷新失败则保留旧值
+ *
+ */
+
+template<typename V>
+struct AsyncCacheOptions {
+    using Clock = std::chrono::steady_clock;
+
+    // 同时进行的加载数上限
+    size_t max_in_flight = 16;
+
+    // 条目加载多久之后触发后台刷新，默认不刷新
+    Clock::duration refresh_after = Clock::duration::max();
+
+    // 时间来源，测试中可以替换为手动推进的时钟
+    std::function<Clock::time_point()> now = Clock::now;
+};
+
+template<typename K, typename V>
+class AsyncLRUCache {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Loader = std::function<std::future<V>(const K &)>;
+
+    // 完成回调：done 与 fail 恰好调用其中一个，且只调用一次；回调不应抛出异常
+    using Done = std::function<void(V)>;
+    using Fail = std::function<void(std::exception_ptr)>;
+    using CallbackLoader = std::function<void(const K &, Done, Fail)>;
+
+    AsyncLRUCache(size_t max_sz, Loader loader, ThreadPool &executor,
+                  AsyncCacheOptions<V> options = AsyncCacheOptions<V>());
+
+    AsyncLRUCache(size_t max_sz, CallbackLoader loader, ThreadPool &executor,
+                  AsyncCacheOptions<V> options = AsyncCacheOptions<V>());
+
+    // 禁用拷贝：执行器中的任务持有 this 指针
+    AsyncLRUCache(const AsyncLRUCache &) = delete;
+
+    AsyncLRUCache &operator=(const AsyncLRUCache &) = delete;
+
+    // 等待所有已提交和排队中的加载结束，因此执行器必须比缓存活得更久
+    ~AsyncLRUCache();
+
+    // 异步缓存查找函数，立即返回
+    std::shared_future<V> AsyncCacheLookup(const K &key);
+
+    // 命中时在调用线程上立即调用 done；未命中时在加载完成的线程上调用 done 或 fail
+    void AsyncCacheLookup(const K &key, Done done, Fail fail);
+
+    size_t Size() const;
+
+    // 正在执行的加载数（不含排队中的）
+    size_t ActiveLoads() const;
+
+private:
+    struct StampedValue {
+        V value;
+        Clock::time_point loaded_at;
+    };
+
+    struct PendingLoad {
+        K key;
+        std::shared_ptr<std::promise<V>> promise;
+    };
+
+    // 一次进行中的加载：future 给通过 future 查找的调用方，回调给注册了回调的调用方
+    struct InFlightLoad {
+        std::shared_future<V> future;
+        std::vector<std::pair<Done, Fail>> callbacks;
+    };
+
+    mutable std::mutex mtx;
+    std::condition_variable idle_cv;
+
+    IntrusiveLRUCache<K, StampedValue> cache;
+
+    // 正在加载或排队中的键（包括后台刷新）
+    std::unordered_map<K, InFlightLoad> in_flight;
+
+    // 因达到 max_in_flight 而排队的加载
+    std::deque<PendingLoad> waiting;
+    size_t active_loads;
+
+    // future 式数据源也包装为回调式
+    CallbackLoader loader;
+    ThreadPool &executor;
+    AsyncCacheOptions<V> options;
+
+    // 调用方需持有 mtx：命中时返回值，条目即将过时时同时启动后台刷新
+    std::optional<V> LookupLocked(const K &key);
+
+    // 调用方需持有 mtx：登记占位并提交或排队一次加载
+    InFlightLoad &StartLoadLocked(const K &key);
+
+    // 调用方需持有 mtx：一次加载结束，启动下一个排队的加载或减少计数
+    void FinishLoadLocked();
+
+    // 在执行器线程上运行：发起加载后立即返回
+    void RunLoad(const K &key, std::shared_ptr<std::promise<V>> promise);
+
+    // 加载完成，可能在任意线程上调用
+    void LoadSucceeded(const K &key, const std::shared_ptr<std::promise<V>> &promise, V value);
+
+    void LoadFailed(const K &key, const std::shared_ptr<std::promise<V>> &promise, std::exception_ptr error);
+
+    // 把返回 future 的数据源包装为回调式：在执行器线程上等待 future
+    static CallbackLoader WaitOnFuture(Loader loader);
+
+    static std::shared_future<V> Ready(const V &value);
+};
+
+#include "AsyncLRUCache.tpp"
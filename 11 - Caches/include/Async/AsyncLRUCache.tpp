@@ -0,0 +1,193 @@
+#pragma once
+
+// 构造函数实现
+template<typename K, typename V>
+AsyncLRUCache<K, V>::AsyncLRUCache(size_t max_sz, Loader loader, ThreadPool &executor,
+                                   AsyncCacheOptions<V> options)
+    : AsyncLRUCache(max_sz, WaitOnFuture(std::move(loader)), executor, std::move(options)) {}
+
+template<typename K, typename V>
+AsyncLRUCache<K, V>::AsyncLRUCache(size_t max_sz, CallbackLoader loader, ThreadPool &executor,
+                                   AsyncCacheOptions<V> options)
+    : cache(max_sz, nullptr), active_loads(0), loader(std::move(loader)), executor(executor),
+      options(std::move(options)) {
+    if (this->options.max_in_flight == 0)
+        this->options.max_in_flight = 1;
+}
+
+template<typename K, typename V>
+AsyncLRUCache<K, V>::~AsyncLRUCache() {
+    std::unique_lock lock(mtx);
+    idle_cv.wait(lock, [this]() { return active_loads == 0 && waiting.empty(); });
+}
+
+// 异步缓存查找函数实现
+template<typename K, typename V>
+std::shared_future<V> AsyncLRUCache<K, V>::AsyncCacheLookup(const K &key) {
+    std::lock_guard lock(mtx);
+
+    auto cached = LookupLocked(key);
+    if (cached.has_value())
+        return Ready(cached.value());
+
+    // 已有加载在进行：共享同一个结果
+    auto it = in_flight.find(key);
+    if (it != in_flight.end())
+        return it->second.future;
+
+    return StartLoadLocked(key).future;
+}
+
+template<typename K, typename V>
+void AsyncLRUCache<K, V>::AsyncCacheLookup(const K &key, Done done, Fail fail) {
+    std::optional<V> cached;
+    {
+        std::lock_guard lock(mtx);
+        cached = LookupLocked(key);
+        if (!cached.has_value()) {
+            // 回调在持有 mtx 时登记，加载完成时一定能看到
+            auto it = in_flight.find(key);
+            InFlightLoad &load = it != in_flight.end() ? it->second : StartLoadLocked(key);
+            load.callbacks.emplace_back(std::move(done), std::move(fail));
+            return;
+        }
+    }
+
+    // 不持有锁调用，回调中可以再次查找
+    done(std::move(cached.value()));
+}
+
+template<typename K, typename V>
+size_t AsyncLRUCache<K, V>::Size() const {
+    std::lock_guard lock(mtx);
+    return cache.Size();
+}
+
+template<typename K, typename V>
+size_t AsyncLRUCache<K, V>::ActiveLoads() const {
+    std::lock_guard lock(mtx);
+    return active_loads;
+}
+
+template<typename K, typename V>
+std::optional<V> AsyncLRUCache<K, V>::LookupLocked(const K &key) {
+    auto cached = cache.TryLookup(key);
+    if (!cached.has_value())
+        return std::nullopt;
+
+    // 条目即将过时：后台刷新，本次仍返回旧值
+    bool stale = options.refresh_after != Clock::duration::max() &&
+                 options.now() - cached->loaded_at >= options.refresh_after;
+    if (stale && in_flight.find(key) == in_flight.end())
+        StartLoadLocked(key);
+
+    return std::move(cached->value);
+}
+
+template<typename K, typename V>
+typename AsyncLRUCache<K, V>::InFlightLoad &AsyncLRUCache<K, V>::StartLoadLocked(const K &key) {
+    auto promise = std::make_shared<std::promise<V>>();
+    auto [it, inserted] = in_flight.emplace(key, InFlightLoad{promise->get_future().share(), {}});
+
+    if (active_loads < options.max_in_flight) {
+        active_loads = active_loads + 1;
+        executor.Submit([this, key, promise]() { RunLoad(key, promise); });
+    } else {
+        waiting.push_back(PendingLoad{key, promise});
+    }
+
+    return it->second;
+}
+
+template<typename K, typename V>
+void AsyncLRUCache<K, V>::FinishLoadLocked() {
+    if (!waiting.empty()) {
+        // 空出的名额直接交给排队最久的加载，active_loads 不变
+        PendingLoad next = std::move(waiting.front());
+        waiting.pop_front();
+        executor.Submit([this, next]() { RunLoad(next.key, next.promise); });
+        return;
+    }
+
+    active_loads = active_loads - 1;
+    if (active_loads == 0)
+        idle_cv.notify_all();
+}
+
+template<typename K, typename V>
+void AsyncLRUCache<K, V>::RunLoad(const K &key, std::shared_ptr<std::promise<V>> promise) {
+    // 数据源可能先调用了回调再抛出，此时加载已经结束，不能再按失败处理
+    auto completed = std::make_shared<std::atomic<bool>>(false);
+    try {
+        loader(key,
+               [this, key, promise, completed](V value) {
+                   completed->store(true);
+                   LoadSucceeded(key, promise, std::move(value));
+               },
+               [this, key, promise, completed](std::exception_ptr error) {
+                   completed->store(true);
+                   LoadFailed(key, promise, error);
+               });
+    } catch (...) {
+        // 发起加载时直接抛出，等同于加载失败
+        if (!completed->load())
+            LoadFailed(key, promise, std::current_exception());
+    }
+}
+
+template<typename K, typename V>
+void AsyncLRUCache<K, V>::LoadSucceeded(const K &key, const std::shared_ptr<std::promise<V>> &promise, V value) {
+    std::vector<std::pair<Done, Fail>> callbacks;
+    {
+        std::lock_guard lock(mtx);
+        cache.Insert(key, StampedValue{value, options.now()});
+        auto it = in_flight.find(key);
+        callbacks = std::move(it->second.callbacks);
+        in_flight.erase(it);
+        FinishLoadLocked();
+    }
+
+    promise->set_value(value);
+    for (auto &[done, fail]: callbacks)
+        done(value);
+}
+
+template<typename K, typename V>
+void AsyncLRUCache<K, V>::LoadFailed(const K &key, const std::shared_ptr<std::promise<V>> &promise,
+                                     std::exception_ptr error) {
+    // 失败不缓存；若是后台刷新失败，旧值仍保留在缓存中
+    std::vector<std::pair<Done, Fail>> callbacks;
+    {
+        std::lock_guard lock(mtx);
+        auto it = in_flight.find(key);
+        callbacks = std::move(it->second.callbacks);
+        in_flight.erase(it);
+        FinishLoadLocked();
+    }
+
+    promise->set_exception(error);
+    for (auto &[done, fail]: callbacks)
+        fail(error);
+}
+
+template<typename K, typename V>
+typename AsyncLRUCache<K, V>::CallbackLoader AsyncLRUCache<K, V>::WaitOnFuture(Loader loader) {
+    return [loader = std::move(loader)](const K &key, Done done, Fail fail) {
+        std::optional<V> data;
+        try {
+            // 阻塞的是执行器线程，而不是发起查找的线程
+            data.emplace(loader(key).get());
+        } catch (...) {
+            fail(std::current_exception());
+            return;
+        }
+        done(std::move(data.value()));
+    };
+}
+
+template<typename K, typename V>
+std::shared_future<V> AsyncLRUCache<K, V>::Ready(const V &value) {
+    std::promise<V> promise;
+    promise.set_value(value);
+    return promise.get_future().share();
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * 固定大小的线程池，作为异步加载与后台刷新的执行器：
+ * 1. Submit 只把任务放入队列后立即返回，不会阻塞调用方
+ * 2. 析构时先执行完队列中剩余的任务，再回收所有工作线程
+ *
+ */
+
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t num_threads);
+
+    // 禁用拷贝：工作线程持有 this 指针
+    ThreadPool(const ThreadPool &) = delete;
+
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool();
+
+    void Submit(std::function<void()> task);
+
+    size_t ThreadCount() const { return workers.size(); }
+
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool stopping;
+
+    void WorkerLoop();
+};
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+/*
+ * CLOCK（二次机会）缓存：
+ * 1. 所有条目存放在一个连续的槽数组中，每个槽带一个访问位
+ * 2. 命中时只把访问位置 1（原子操作），不移动任何链表节点
+ * 3. 未命中且缓存已满时，时钟指针沿数组扫描：访问位为 1 的槽清零后跳过（给第二次机会），
+ *    遇到访问位为 0 的槽即淘汰
+ * 4. 命中完全不加锁：
+ *    - 索引是定长的开放寻址表，每个桶是一个原子的槽下标，读者沿探测序列查找，
+ *      删除只留下墓碑、从不把桶清空，因此读者不会漏掉存在的键；墓碑过多时整表重建后原子替换
+ *    - 槽中保存指向不可变节点（键、值）的原子指针，替换条目时发布新节点，旧节点退休
+ *    - 读者进出时在本线程所属的计数分条上加减（每个分条独占一条缓存行），不写任何共享的缓存行；
+ *      写者攒够一批退休节点后等待所有分条上的读者离开，再回收复用这些节点
+ * 5. 插入和淘汰由一把互斥锁串行化，读者从不等待写者
+ *
+ */
+
+// 不可变的条目，发布后只读，回收后才会被写者复用
+template<typename K, typename V>
+struct ClockNode {
+    K key;
+    V value;
+};
+
+template<typename K, typename V>
+struct ClockSlot {
+    std::atomic<ClockNode<K, V> *> node;
+    std::atomic<bool> referenced;
+
+    ClockSlot() : node(nullptr), referenced(false) {}
+};
+
+template<typename K, typename V>
+class ClockCache {
+private:
+    using Node = ClockNode<K, V>;
+
+    // 开放寻址索引：桶中是槽下标，EMPTY 与 TOMBSTONE 为保留值
+    struct IndexTable {
+        std::unique_ptr<std::atomic<uint32_t>[]> buckets;
+        unsigned bits;
+
+        explicit IndexTable(unsigned bits);
+
+        size_t Size() const { return size_t{1} << bits; }
+    };
+
+    static constexpr uint32_t EMPTY = UINT32_MAX;
+    static constexpr uint32_t TOMBSTONE = UINT32_MAX - 1;
+    static constexpr size_t NOT_FOUND = SIZE_MAX;
+
+    // 读者计数分条，按线程分配，每个分条按奇偶两个阶段计数
+    static constexpr size_t READER_STRIPES = 16;
+
+    struct alignas(64) ReaderStripe {
+        std::atomic<size_t> active[2] = {0, 0};
+    };
+
+    // 读临界区：构造时登记，析构时离开
+    class ReadSection {
+    public:
+        explicit ReadSection(const ClockCache &cache);
+
+        ~ReadSection();
+
+    private:
+        std::atomic<size_t> &counter;
+    };
+
+    // 攒够这么多退休节点后回收一次
+    static constexpr size_t RECLAIM_BATCH = 64;
+
+    // 槽数组在构造时一次性分配，之后不再移动
+    std::vector<ClockSlot<K, V>> slots;
+
+    std::atomic<IndexTable *> table;
+    size_t tombstones;
+
+    // 时钟指针与已使用的槽数
+    size_t hand;
+    size_t used;
+
+    mutable ReaderStripe stripes[READER_STRIPES];
+    std::atomic<size_t> phase;
+
+    // 写者之间互斥
+    mutable std::mutex mtx;
+
+    // 已摘下、读者可能仍在访问的节点，以及回收后可以复用的节点
+    std::vector<Node *> retired;
+    std::vector<Node *> free_nodes;
+
+    // 慢速数据源
+    std::function<V(const K &)> data_source;
+
+    static size_t StripeIndex();
+
+    static size_t HashOf(const K &key, unsigned bits);
+
+    // 探测结果：桶下标（不存在时为 NOT_FOUND）、探测时看到的槽下标与节点
+    struct ProbeResult {
+        size_t bucket;
+        uint32_t position;
+        Node *node;
+    };
+
+    ProbeResult Probe(const IndexTable &index, const K &key) const;
+
+    // 以下由持有 mtx 的写者调用
+    void IndexInsert(IndexTable &index, const K &key, uint32_t position);
+
+    void Rebuild();
+
+    Node *MakeNode(const K &key, const V &value);
+
+    void Retire(Node *node);
+
+    // 等待在此之前进入的读者全部离开
+    void Synchronize();
+
+    size_t FindVictim();
+
+public:
+    // 构造函数
+    ClockCache(size_t max_sz, std::function<V(const K &)> source);
+
+    // 禁用拷贝：槽中的节点由缓存持有
+    ClockCache(const ClockCache &) = delete;
+
+    ClockCache &operator=(const ClockCache &) = delete;
+
+    ~ClockCache();
+
+    // 缓存查找函数，可被多个线程同时调用
+    V CacheLookup(const K &key);
+
+    // 只查缓存不访问数据源，命中时设置访问位；不加锁
+    std::optional<V> TryLookup(const K &key);
+
+    // 插入或覆盖一个条目，必要时转动时钟指针淘汰一个条目
+    void Insert(const K &key, const V &value);
+
+    size_t Size() const;
+};
+
+#include "ClockCache.tpp"
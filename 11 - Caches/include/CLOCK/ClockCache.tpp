@@ -0,0 +1,249 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <thread>
+
+template<typename K, typename V>
+ClockCache<K, V>::IndexTable::IndexTable(unsigned bits)
+    : buckets(std::make_unique<std::atomic<uint32_t>[]>(size_t{1} << bits)), bits(bits) {
+    for (size_t i = 0; i < Size(); ++i)
+        buckets[i].store(EMPTY, std::memory_order_relaxed);
+}
+
+template<typename K, typename V>
+ClockCache<K, V>::ReadSection::ReadSection(const ClockCache &cache)
+    : counter(cache.stripes[StripeIndex()].active[cache.phase.load() & 1]) {
+    // 与写者的顺序一致操作配对：写者要么看到这次登记并等待，要么登记之后的读取能看到写者的摘除
+    counter.fetch_add(1);
+}
+
+template<typename K, typename V>
+ClockCache<K, V>::ReadSection::~ReadSection() {
+    counter.fetch_sub(1, std::memory_order_release);
+}
+
+// 构造函数实现
+template<typename K, typename V>
+ClockCache<K, V>::ClockCache(size_t max_sz, std::function<V(const K &)> source)
+    : slots(max_sz), table(nullptr), tombstones(0), hand(0), used(0), phase(0),
+      data_source(std::move(source)) {
+    if (max_sz >= TOMBSTONE)
+        throw std::length_error("ClockCache capacity exceeds the 32-bit slot index");
+
+    // 桶数至少为容量的 4 倍：有效条目与墓碑合计不超过一半，探测序列很短；
+    // 至少 2 个桶，保证表中总有空桶、哈希取高位时位数不为 0
+    size_t buckets = std::bit_ceil(std::max(max_sz * 4, size_t{2}));
+    table.store(new IndexTable(static_cast<unsigned>(std::bit_width(buckets) - 1)));
+}
+
+template<typename K, typename V>
+ClockCache<K, V>::~ClockCache() {
+    for (size_t i = 0; i < used; ++i)
+        delete slots[i].node.load(std::memory_order_relaxed);
+    for (Node *node: retired)
+        delete node;
+    for (Node *node: free_nodes)
+        delete node;
+    delete table.load(std::memory_order_relaxed);
+}
+
+// 缓存查找函数实现
+template<typename K, typename V>
+V ClockCache<K, V>::CacheLookup(const K &key) {
+    auto cached = TryLookup(key);
+    if (cached.has_value())
+        return std::move(cached.value());
+
+    // 在锁外访问慢速数据源
+    V data = data_source(key);
+    Insert(key, data);
+
+    return data;
+}
+
+template<typename K, typename V>
+std::optional<V> ClockCache<K, V>::TryLookup(const K &key) {
+    ReadSection section(*this);
+
+    ProbeResult found = Probe(*table.load(), key);
+    if (found.bucket == NOT_FOUND)
+        return std::nullopt;
+
+    ClockSlot<K, V> &slot = slots[found.position];
+
+    // 先读后写：访问位已经为 1 时不写内存，避免缓存行在核间来回失效
+    if (!slot.referenced.load(std::memory_order_relaxed))
+        slot.referenced.store(true, std::memory_order_relaxed);
+
+    return found.node->value;
+}
+
+template<typename K, typename V>
+void ClockCache<K, V>::Insert(const K &key, const V &value) {
+    if (slots.empty())
+        return;
+
+    std::lock_guard lock(mtx);
+    IndexTable &index = *table.load(std::memory_order_relaxed);
+
+    ProbeResult existing = Probe(index, key);
+    if (existing.bucket != NOT_FOUND) {
+        // 键已存在（例如并发未命中后重复插入）：发布新节点覆盖值
+        ClockSlot<K, V> &slot = slots[existing.position];
+        slot.node.store(MakeNode(key, value));
+        slot.referenced.store(true, std::memory_order_relaxed);
+        Retire(existing.node);
+        return;
+    }
+
+    size_t position;
+    if (used < slots.size()) {
+        position = used;
+        used = used + 1;
+    } else {
+        // 先在索引中留下墓碑，再替换槽中的节点；仍持有旧下标的读者会发现键不符并继续探测
+        position = FindVictim();
+        Node *victim = slots[position].node.load(std::memory_order_relaxed);
+        index.buckets[Probe(index, victim->key).bucket].store(TOMBSTONE);
+        tombstones = tombstones + 1;
+        Retire(victim);
+    }
+
+    // 新条目的访问位为 0：只访问过一次的键会最先被淘汰
+    slots[position].referenced.store(false, std::memory_order_relaxed);
+    slots[position].node.store(MakeNode(key, value));
+    IndexInsert(index, key, static_cast<uint32_t>(position));
+
+    if (tombstones >= slots.size())
+        Rebuild();
+}
+
+template<typename K, typename V>
+size_t ClockCache<K, V>::Size() const {
+    std::lock_guard lock(mtx);
+    return used;
+}
+
+template<typename K, typename V>
+size_t ClockCache<K, V>::StripeIndex() {
+    static std::atomic<size_t> next_stripe{0};
+    thread_local size_t index = next_stripe.fetch_add(1, std::memory_order_relaxed) % READER_STRIPES;
+    return index;
+}
+
+template<typename K, typename V>
+size_t ClockCache<K, V>::HashOf(const K &key, unsigned bits) {
+    // 乘以黄金比例常数打散后取高位，整数键的恒等哈希也能均匀分布
+    uint64_t mixed = static_cast<uint64_t>(std::hash<K>{}(key)) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(mixed >> (64 - bits));
+}
+
+template<typename K, typename V>
+typename ClockCache<K, V>::ProbeResult ClockCache<K, V>::Probe(const IndexTable &index, const K &key) const {
+    size_t mask = index.Size() - 1;
+    size_t bucket = HashOf(key, index.bits);
+
+    // 表中总有空桶，遇到空桶即可确定键不存在
+    for (size_t step = 0; step < index.Size(); ++step) {
+        uint32_t position = index.buckets[bucket].load();
+        if (position == EMPTY)
+            break;
+
+        if (position != TOMBSTONE) {
+            Node *candidate = slots[position].node.load();
+            if (candidate != nullptr && candidate->key == key)
+                return ProbeResult{bucket, position, candidate};
+        }
+
+        bucket = (bucket + 1) & mask;
+    }
+
+    return ProbeResult{NOT_FOUND, EMPTY, nullptr};
+}
+
+template<typename K, typename V>
+void ClockCache<K, V>::IndexInsert(IndexTable &index, const K &key, uint32_t position) {
+    size_t mask = index.Size() - 1;
+    size_t bucket = HashOf(key, index.bits);
+
+    while (true) {
+        uint32_t current = index.buckets[bucket].load(std::memory_order_relaxed);
+        if (current == EMPTY || current == TOMBSTONE) {
+            if (current == TOMBSTONE)
+                tombstones = tombstones - 1;
+            index.buckets[bucket].store(position);
+            return;
+        }
+        bucket = (bucket + 1) & mask;
+    }
+}
+
+template<typename K, typename V>
+void ClockCache<K, V>::Rebuild() {
+    IndexTable *old_table = table.load(std::memory_order_relaxed);
+    auto *fresh = new IndexTable(old_table->bits);
+    for (size_t i = 0; i < used; ++i)
+        IndexInsert(*fresh, slots[i].node.load(std::memory_order_relaxed)->key, static_cast<uint32_t>(i));
+
+    // 重建很少发生，直接等待读者离开旧表后释放
+    table.store(fresh);
+    tombstones = 0;
+    Synchronize();
+    delete old_table;
+}
+
+template<typename K, typename V>
+typename ClockCache<K, V>::Node *ClockCache<K, V>::MakeNode(const K &key, const V &value) {
+    if (free_nodes.empty())
+        return new Node{key, value};
+
+    // 复用已回收的节点，键和值的赋值可以沿用原有的内存（例如字符串的缓冲区）
+    Node *node = free_nodes.back();
+    free_nodes.pop_back();
+    node->key = key;
+    node->value = value;
+    return node;
+}
+
+template<typename K, typename V>
+void ClockCache<K, V>::Retire(Node *node) {
+    retired.push_back(node);
+    if (retired.size() < RECLAIM_BATCH)
+        return;
+
+    Synchronize();
+    free_nodes.insert(free_nodes.end(), retired.begin(), retired.end());
+    retired.clear();
+}
+
+template<typename K, typename V>
+void ClockCache<K, V>::Synchronize() {
+    // 两个阶段各切换一次：新读者登记到另一组计数上，旧计数只减不增，等待不会被源源不断的读者饿死
+    for (int round = 0; round < 2; ++round) {
+        size_t old_phase = phase.fetch_add(1) & 1;
+        for (ReaderStripe &stripe: stripes) {
+            while (stripe.active[old_phase].load() != 0)
+                std::this_thread::yield();
+        }
+    }
+}
+
+template<typename K, typename V>
+size_t ClockCache<K, V>::FindVictim() {
+    // 最多转两圈：第一圈清零所有访问位，第二圈必然找到受害者
+    while (true) {
+        ClockSlot<K, V> &slot = slots[hand];
+        size_t position = hand;
+
+        hand = hand + 1;
+        if (hand >= slots.size())
+            hand = 0;
+
+        if (!slot.referenced.load(std::memory_order_relaxed))
+            return position;
+
+        slot.referenced.store(false, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+/*
+ * 侵入式 LRU 缓存：
+ * 1. 哈希桶链表指针和时序链表指针都直接存放在缓存条目中
+ * 2. 每个条目只分配一次，键只保存一份
+ * 3. 命中时只需把条目摘下并挂到链表尾部，不分配也不释放内存
+ * 4. 淘汰时条目记得自己的哈希值和桶中前驱，O(1) 摘除，无需再次哈希
+ *
+ */
+
+template<typename K, typename V>
+struct IntrusiveCacheEntry {
+    K key;
+    V value;
+    size_t hash;
+
+    // 哈希桶中的单向链表；bucket_prev 指向前驱的 bucket_next 字段（或桶头），便于 O(1) 摘除
+    IntrusiveCacheEntry *bucket_next;
+    IntrusiveCacheEntry **bucket_prev;
+
+    // 访问时序双向链表，front 端最久未使用
+    IntrusiveCacheEntry *prev;
+    IntrusiveCacheEntry *next;
+
+    IntrusiveCacheEntry(const K &k, const V &v, size_t h)
+        : key(k), value(v), hash(h), bucket_next(nullptr), bucket_prev(nullptr),
+          prev(nullptr), next(nullptr) {
+    }
+};
+
+template<typename K, typename V>
+class IntrusiveLRUCache {
+private:
+    using Entry = IntrusiveCacheEntry<K, V>;
+
+    // 桶数为 2 的幂，用位与代替取模
+    std::vector<Entry *> bins;
+    size_t mask;
+
+    Entry *front;
+    Entry *back;
+
+    size_t max_size;
+    size_t current_size;
+
+    // 慢速数据源
+    std::function<V(const K &)> data_source;
+
+    Entry *Find(const K &key, size_t hash) const;
+
+    void LinkBucket(Entry *entry);
+
+    void UnlinkBucket(Entry *entry);
+
+    void PushBack(Entry *entry);
+
+    void Unlink(Entry *entry);
+
+public:
+    // 构造函数：按容量一次性分配好桶数组，之后不再扩容
+    IntrusiveLRUCache(size_t max_sz, std::function<V(const K &)> source);
+
+    // 禁用拷贝，防止浅拷贝导致 double free
+    IntrusiveLRUCache(const IntrusiveLRUCache &) = delete;
+
+    IntrusiveLRUCache &operator=(const IntrusiveLRUCache &) = delete;
+
+    ~IntrusiveLRUCache();
+
+    // 缓存查找函数
+    V CacheLookup(const K &key);
+
+    // 只查缓存不访问数据源；命中时同样更新访问时序
+    std::optional<V> TryLookup(const K &key);
+
+    // 插入或覆盖一个条目，必要时淘汰最久未使用的条目
+    void Insert(const K &key, const V &value);
+
+    size_t Size() const { return current_size; }
+};
+
+#include "IntrusiveLRUCache.tpp"
@@ -0,0 +1,146 @@
+#pragma once
+
+// 构造函数实现
+template<typename K, typename V>
+IntrusiveLRUCache<K, V>::IntrusiveLRUCache(size_t max_sz, std::function<V(const K &)> source)
+    : mask(0), front(nullptr), back(nullptr), max_size(max_sz), current_size(0),
+      data_source(std::move(source)) {
+    size_t num_bins = 1;
+    while (num_bins < max_size)
+        num_bins = num_bins * 2;
+
+    bins.assign(num_bins, nullptr);
+    mask = num_bins - 1;
+}
+
+// 析构函数：沿时序链表释放所有条目
+template<typename K, typename V>
+IntrusiveLRUCache<K, V>::~IntrusiveLRUCache() {
+    while (front != nullptr) {
+        Entry *temp = front;
+        front = front->next;
+        delete temp;
+    }
+}
+
+// 缓存查找函数实现
+template<typename K, typename V>
+V IntrusiveLRUCache<K, V>::CacheLookup(const K &key) {
+    auto cached = TryLookup(key);
+    if (cached.has_value())
+        return std::move(cached.value());
+
+    // 先取数据再淘汰：数据源抛出异常时缓存保持不变
+    V data = data_source(key);
+    Insert(key, data);
+
+    return data;
+}
+
+template<typename K, typename V>
+std::optional<V> IntrusiveLRUCache<K, V>::TryLookup(const K &key) {
+    Entry *entry = Find(key, std::hash<K>{}(key));
+    if (entry == nullptr)
+        return std::nullopt;
+
+    // 缓存命中：只做指针拼接，把条目移到链表尾部
+    if (entry != back) {
+        Unlink(entry);
+        PushBack(entry);
+    }
+    return entry->value;
+}
+
+template<typename K, typename V>
+void IntrusiveLRUCache<K, V>::Insert(const K &key, const V &value) {
+    if (max_size == 0)
+        return;
+
+    size_t hash = std::hash<K>{}(key);
+    Entry *entry = Find(key, hash);
+
+    if (entry != nullptr) {
+        // 键已存在（例如并发未命中后重复插入）：覆盖值并更新时序
+        entry->value = value;
+        if (entry != back) {
+            Unlink(entry);
+            PushBack(entry);
+        }
+        return;
+    }
+
+    if (current_size >= max_size) {
+        // 复用最久未使用的条目，稳态下的未命中同样不分配内存
+        Entry *victim = front;
+        Unlink(victim);
+        UnlinkBucket(victim);
+
+        victim->key = key;
+        victim->value = value;
+        victim->hash = hash;
+        entry = victim;
+    } else {
+        entry = new Entry(key, value, hash);
+        current_size = current_size + 1;
+    }
+
+    LinkBucket(entry);
+    PushBack(entry);
+}
+
+template<typename K, typename V>
+IntrusiveCacheEntry<K, V> *IntrusiveLRUCache<K, V>::Find(const K &key, size_t hash) const {
+    Entry *current = bins[hash & mask];
+    while (current != nullptr && (current->hash != hash || current->key != key))
+        current = current->bucket_next;
+
+    return current;
+}
+
+template<typename K, typename V>
+void IntrusiveLRUCache<K, V>::LinkBucket(Entry *entry) {
+    Entry *&head = bins[entry->hash & mask];
+
+    entry->bucket_next = head;
+    entry->bucket_prev = &head;
+    if (head != nullptr)
+        head->bucket_prev = &entry->bucket_next;
+    head = entry;
+}
+
+template<typename K, typename V>
+void IntrusiveLRUCache<K, V>::UnlinkBucket(Entry *entry) {
+    *entry->bucket_prev = entry->bucket_next;
+    if (entry->bucket_next != nullptr)
+        entry->bucket_next->bucket_prev = entry->bucket_prev;
+
+    entry->bucket_next = nullptr;
+    entry->bucket_prev = nullptr;
+}
+
+template<typename K, typename V>
+void IntrusiveLRUCache<K, V>::PushBack(Entry *entry) {
+    entry->prev = back;
+    entry->next = nullptr;
+    if (back == nullptr)
+        front = entry;
+    else
+        back->next = entry;
+    back = entry;
+}
+
+template<typename K, typename V>
+void IntrusiveLRUCache<K, V>::Unlink(Entry *entry) {
+    if (entry->prev != nullptr)
+        entry->prev->next = entry->next;
+    else
+        front = entry->next;
+
+    if (entry->next != nullptr)
+        entry->next->prev = entry->prev;
+    else
+        back = entry->prev;
+
+    entry->prev = nullptr;
+    entry->next = nullptr;
+}
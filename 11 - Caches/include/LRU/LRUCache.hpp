@@ -1,37 +1,206 @@
 #pragma once
 
+#include <chrono>
+#include <memory>
+#include <span>
 #include <unordered_map>
 #include <functional>
-#include "../Queue/queue.hpp"
+#include <vector>
+#include "../Policy/LRUPolicy.hpp"
+#include "../TimerWheel/TimerWheel.hpp"
+#include "../Stats/CacheStats.hpp"
+#include "../Snapshot/Snapshot.hpp"
 
-template<typename K, typename V>
+// 条目的附加信息：权重与过期定时器。只有设置了 weigher 或过期时间的缓存才为条目分配它；
+// 定时器以哈希表中键的地址标识条目（节点地址在重新哈希时不变），不再复制一份键；
+// 定时器不在时间轮中（pprev 为 nullptr）表示条目永不过期
+template<typename K>
+struct CacheEntryMeta {
+    size_t weight;
+    TimerNode<const K*> timer;
+
+    CacheEntryMeta(const K* k, size_t w) : weight(w), timer(k) {}
+};
+
+// Handle 为淘汰策略保存在条目中的私有数据，默认即 LRU 的队列节点指针
+template<typename K, typename V, typename Handle = QueueListNode<K>*>
 struct CacheEntry {
     K key;
     V value;
-    QueueListNode<K>* node;
+    Handle node;
+
+    // 未设置 weigher 与过期时间时为空
+    std::unique_ptr<CacheEntryMeta<K>> meta;
     
-    CacheEntry() : key(K()), value(V()), node(nullptr) {}
-    CacheEntry(const K& k, const V& v, QueueListNode<K>* n) 
+    CacheEntry() : key(K()), value(V()), node() {}
+    CacheEntry(const K& k, const V& v, Handle n) 
         : key(k), value(v), node(n) {}
 };
 
+/*
+ * 可选配置：
+ * weigher 为每个条目计算权重（例如值占用的字节数），此时 max_size 表示总权重上限；
+ * 不设置时每个条目权重为 1，max_size 即条目数上限（原有行为）。
+ * 只有 Policy::SUPPORTS_WEIGHER 为 true 的策略（LRUPolicy）可以设置 weigher，否则构造函数抛出 std::invalid_argument
+ *
+ * 过期（TTL）：
+ * 1. expire_after_write：条目加载后的存活时间；expiry 可以按条目单独计算，设置时取代前者
+ * 2. expire_after_access：条目多久未被访问即过期，每次命中重新计时，但不超过写入时的期限
+ * 3. 时长为 Clock::duration::max() 表示永不过期（默认），此时条目不分配定时器
+ * 4. 命中时若已过期则当作未命中重新加载；其余过期条目由 Cleanup() 通过时间轮批量回收，
+ *    timer_tick 是时间轮的刻度，只影响 Cleanup() 回收的及时程度，不影响命中时的判断
+ */
 template<typename K, typename V>
+struct LRUCacheOptions {
+    using Clock = std::chrono::steady_clock;
+
+    std::function<size_t(const K&, const V&)> weigher;
+
+    // 批量数据源：按顺序返回每个键的值，CacheLookupMany 用一次调用加载所有未命中的键；
+    // 不设置时逐个调用 data_source
+    std::function<std::vector<V>(std::span<const K>)> bulk_source;
+
+    Clock::duration expire_after_write = Clock::duration::max();
+    Clock::duration expire_after_access = Clock::duration::max();
+    std::function<Clock::duration(const K&, const V&)> expiry;
+
+    Clock::duration timer_tick = std::chrono::seconds(1);
+
+    // 条目因容量不足被淘汰时调用（过期移除不调用，被选中淘汰时已经过期的条目也不调用），调用时条目尚未删除；
+    // 回调中不能再访问缓存，例如把条目转存到下一层存储（见 Tiered/TieredCache.hpp）
+    std::function<void(const K&, const V&)> on_evict;
+
+    // 时间来源，测试中可以替换为手动推进的时钟
+    std::function<Clock::time_point()> now = Clock::now;
+};
+
+/*
+ * 淘汰策略作为模板参数（接口见 Policy/LRUPolicy.hpp），默认是 LRU：
+ * LRUCache<K, V, SLRUPolicy<K>>、LRUCache<K, V, ARCPolicy<K>> 共用同一套存储，
+ * 策略钩子在编译期内联，没有虚函数调用的开销
+ *
+ * 统计同样是模板参数（见 Stats/CacheStats.hpp）：默认的 NullCacheStats 不占空间也不产生任何代码，
+ * LRUCache<K, V, LRUPolicy<K>, CacheStats> 记录命中、未命中、淘汰、过期次数与数据源延迟
+ */
+template<typename K, typename V, typename Policy = LRUPolicy<K>, typename Stats = NullCacheStats>
 class LRUCache {
 private:
-    std::unordered_map<K, CacheEntry<K, V>> ht;
-    Queue<K> q;
+    using Entry = CacheEntry<K, V, typename Policy::Handle>;
+    using Clock = std::chrono::steady_clock;
+
+    std::unordered_map<K, Entry> ht;
+    Policy policy;
+
+    // 容量与当前用量，单位是权重（未设置 weigher 时即条目数）
     size_t max_size;
     size_t current_size;
 
     // 慢速数据源
     std::function<V(const K&)> data_source;
 
+    LRUCacheOptions<K, V> options;
+
+    // 带定时器的条目按到期时间挂在时间轮上；只在配置了过期时间时创建
+    std::unique_ptr<TimerWheel<const K*>> wheel;
+
+    [[no_unique_address]] Stats stats;
+
+    using Iterator = typename std::unordered_map<K, Entry>::iterator;
+
+    size_t Weigh(const K& key, const V& value) const;
+
+    // 是否需要为条目保存附加信息
+    bool HasMeta() const { return options.weigher || wheel; }
+
+    // 已缓存条目的权重
+    size_t WeightOf(const Entry& entry) const;
+
+    // 查找条目：已过期的条目当作不存在并移除，未过期的按访问时间续期
+    Iterator FindLive(const K& key);
+
+    // 创建缓存条目，调用方需先腾出空间
+    void Admit(const K& key, const V& data, size_t weight);
+
+    // 加载一批键，结果与 keys 一一对应
+    std::vector<V> LoadMany(std::span<const K> keys);
+
+    // 调用数据源；启用统计时记录耗时，未启用时不读取时钟
+    template<typename F>
+    auto TimedLoad(F load) -> decltype(load());
+
+    // 按淘汰策略移除条目，直到能再放下 weight
+    void EvictFor(size_t weight);
+
+    // 为新条目设置到期时间并放入时间轮，永不过期时不放入
+    void StartTimer(TimerNode<const K*>& timer, const V& value);
+
+    // 命中时按 expire_after_access 推迟到期时间
+    void Touch(TimerNode<const K*>& timer, Clock::time_point now);
+
+    // 条目是否已经过期（未设置过期时间时总是 false）
+    bool Expired(const Entry& entry, Clock::time_point now) const;
+
+    // 从时间轮中取出条目的定时器；附加信息随条目一起释放
+    void CancelTimer(Entry& entry);
+
+    // 移除过期条目（不经过淘汰策略的 Victim）
+    void Remove(Iterator it);
+
+    // 清空缓存后按给定顺序重建
+    void Restore(const SnapshotEntries<K, V>& entries);
+
+    static Clock::time_point Deadline(Clock::time_point now, Clock::duration ttl);
+
 public:
     // 构造函数
     LRUCache(size_t max_sz, std::function<V(const K&)> source);
+
+    LRUCache(size_t max_sz, std::function<V(const K&)> source, LRUCacheOptions<K, V> opts);
+
+    // 禁用拷贝：时间轮保存的是条目中定时器的地址
+    LRUCache(const LRUCache&) = delete;
+
+    LRUCache& operator=(const LRUCache&) = delete;
     
     // 缓存查找函数
     V CacheLookup(const K& key);
+
+    /*
+     * 批量查找，结果与 keys 一一对应：
+     * 1. 先处理所有命中，再收集未命中的键（批次内重复的键只加载一次）
+     * 2. 调用一次 bulk_source 加载所有未命中的键
+     * 3. 一次淘汰腾出所需空间后插入；放不下全部时保留批次中靠后的键，与逐个查找的结果一致
+     */
+    std::vector<V> CacheLookupMany(std::span<const K> keys);
+
+    // 回收所有已过期的条目，返回回收的条目数
+    size_t Cleanup();
+
+    // 条目数（包括已过期但尚未回收的条目）
+    size_t Size() const { return ht.size(); }
+
+    // 所有条目的权重之和
+    size_t CurrentWeight() const { return current_size; }
+
+    // 统计对象，启用 CacheStats 时可调用 Statistics().Snapshot()
+    const Stats& Statistics() const { return stats; }
+
+    /*
+     * 快照（文件格式见 Snapshot/Snapshot.hpp）：
+     * 1. Entries 按最先淘汰到最后淘汰的顺序复制所有未过期的条目；
+     *    之后可以在后台线程中调用 WriteSnapshot 写出副本，复制之外的时间不占用缓存
+     * 2. SaveSnapshot 即复制后立即写出
+     * 3. LoadSnapshot 用快照替换缓存内容：一次预留哈希表空间，按原顺序插入，LRU 的访问顺序被完整还原；
+     *    容量放不下时保留最后淘汰的条目，过期时间从加载时重新计算；
+     *    快照损坏或不存在时返回 false，缓存保持不变
+     */
+    SnapshotEntries<K, V> Entries() const;
+
+    template<typename KeySerializer = Serializer<K>, typename ValueSerializer = Serializer<V>>
+    bool SaveSnapshot(const std::string& path) const;
+
+    template<typename KeySerializer = Serializer<K>, typename ValueSerializer = Serializer<V>>
+    bool LoadSnapshot(const std::string& path);
 };
 
 #include "LRUCache.tpp"
\ No newline at end of file
@@ -1,49 +1,367 @@
 #pragma once
 
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+
 // 构造函数实现
-template<typename K, typename V>
-LRUCache<K, V>::LRUCache(size_t max_sz, std::function<V(const K&)> source) 
-    : max_size(max_sz), current_size(0), data_source(source) {}
+template<typename K, typename V, typename Policy, typename Stats>
+LRUCache<K, V, Policy, Stats>::LRUCache(size_t max_sz, std::function<V(const K&)> source) 
+    : LRUCache(max_sz, std::move(source), LRUCacheOptions<K, V>()) {}
+
+template<typename K, typename V, typename Policy, typename Stats>
+LRUCache<K, V, Policy, Stats>::LRUCache(size_t max_sz, std::function<V(const K&)> source,
+                                 LRUCacheOptions<K, V> opts) 
+    : policy(max_sz), max_size(max_sz), current_size(0), data_source(std::move(source)),
+      options(std::move(opts)) {
+    if (options.weigher && !Policy::SUPPORTS_WEIGHER)
+        throw std::invalid_argument("LRUCache: the eviction policy sizes its segments by entry count, "
+                                    "weigher is not supported");
+
+    // 时间轮约 2 KB，不设置过期时间的缓存不创建
+    if (options.expiry || options.expire_after_write != Clock::duration::max() ||
+        options.expire_after_access != Clock::duration::max())
+        wheel = std::make_unique<TimerWheel<const K*>>(options.timer_tick, options.now());
+}
 
 // 缓存查找函数实现
-template<typename K, typename V>
-V LRUCache<K, V>::CacheLookup(const K& key) {
+template<typename K, typename V, typename Policy, typename Stats>
+V LRUCache<K, V, Policy, Stats>::CacheLookup(const K& key) {
     // 1. 在哈希表中查找缓存条目
-    auto it = ht.find(key);
-    CacheEntry<K, V>* entry = (it != ht.end()) ? &(it->second) : nullptr;
+    auto it = FindLive(key);
+    Entry* entry = (it != ht.end()) ? &(it->second) : nullptr;
     
     if (entry == nullptr) {
-        // 2. 如果缓存已满，需要移除最旧的条目
-        if (current_size >= max_size) {
-            auto key_to_remove_opt = Dequeue(q);
-            if (key_to_remove_opt.has_value()) {
-                K key_to_remove = key_to_remove_opt.value();
-                ht.erase(key_to_remove);
-                current_size = current_size - 1;
-            }
-        }
-        
-        // 3. 从慢速数据源获取数据
-        V data = data_source(key);
+        stats.RecordMiss();
+        policy.OnMiss(key);
+
+        // 2. 从慢速数据源获取数据（权重取决于数据，所以先取数据再淘汰）
+        V data = TimedLoad([&]() { return data_source(key); });
+        size_t weight = Weigh(key, data);
+
+        // 3. 单个条目超过总容量：直接返回，不放入缓存
+        if (weight > max_size)
+            return data;
+
+        // 4. 由淘汰策略移除条目，直到能放下新条目
+        EvictFor(weight);
         
-        // 4. 将新键入队并创建缓存条目
-        Enqueue(q, key);
-        CacheEntry<K, V> new_entry(key, data, q.back);
-        ht[key] = new_entry;
-        current_size = current_size + 1;
+        // 5. 通知淘汰策略并创建缓存条目
+        Admit(key, data, weight);
         
         return data;
     } else {
-        // 缓存命中：重置该键在队列中的位置
-        // 移除旧节点
-        RemoveNode(q, entry->node);
-        
-        // 重新入队
-        Enqueue(q, key);
-        
-        // 更新缓存条目中的节点指针
-        entry->node = q.back;
+        // 缓存命中：由淘汰策略更新该键的位置（LRU 即移到队尾）
+        stats.RecordHit();
+        policy.OnHit(entry->node);
         
         return entry->value;
     }
 }
+
+// 批量查找函数实现
+template<typename K, typename V, typename Policy, typename Stats>
+std::vector<V> LRUCache<K, V, Policy, Stats>::CacheLookupMany(std::span<const K> keys) {
+    // 1. 先处理命中，记录未命中的键
+    std::vector<std::optional<V>> hits(keys.size());
+    std::vector<K> missing;
+    std::unordered_map<K, size_t> missing_index;
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        auto it = FindLive(keys[i]);
+        if (it != ht.end()) {
+            stats.RecordHit();
+            policy.OnHit(it->second.node);
+            hits[i] = it->second.value;
+            continue;
+        }
+
+        stats.RecordMiss();
+        if (missing_index.emplace(keys[i], missing.size()).second) {
+            // 与逐个查找一致：每个未命中的键都在淘汰之前通知策略，无论最终是否放入缓存
+            policy.OnMiss(keys[i]);
+            missing.push_back(keys[i]);
+        }
+    }
+
+    // 2. 一次加载所有未命中的键
+    std::vector<V> loaded;
+    if (!missing.empty())
+        loaded = LoadMany(missing);
+
+    // 3. 从后往前选出能放下的键，一次淘汰腾出它们的总权重
+    std::vector<size_t> weights(missing.size());
+    std::vector<bool> admit(missing.size(), false);
+    size_t total = 0;
+
+    for (size_t j = missing.size(); j-- > 0;) {
+        weights[j] = Weigh(missing[j], loaded[j]);
+        if (weights[j] > max_size)
+            continue;
+        if (total + weights[j] > max_size)
+            break;
+
+        admit[j] = true;
+        total = total + weights[j];
+    }
+
+    EvictFor(total);
+
+    for (size_t j = 0; j < missing.size(); ++j) {
+        if (!admit[j])
+            continue;
+
+        Admit(missing[j], loaded[j], weights[j]);
+    }
+
+    // 4. 按请求顺序组装结果
+    std::vector<V> result;
+    result.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (hits[i].has_value())
+            result.push_back(std::move(hits[i].value()));
+        else
+            result.push_back(loaded[missing_index[keys[i]]]);
+    }
+
+    return result;
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+SnapshotEntries<K, V> LRUCache<K, V, Policy, Stats>::Entries() const {
+    SnapshotEntries<K, V> entries;
+    entries.reserve(ht.size());
+
+    Clock::time_point now = options.now();
+    policy.ForEach([&](const K& key) {
+        const Entry& entry = ht.find(key)->second;
+        if (Expired(entry, now))
+            return;
+        entries.emplace_back(key, entry.value);
+    });
+
+    return entries;
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+template<typename KeySerializer, typename ValueSerializer>
+bool LRUCache<K, V, Policy, Stats>::SaveSnapshot(const std::string& path) const {
+    return WriteSnapshot<K, V, KeySerializer, ValueSerializer>(path, Entries());
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+template<typename KeySerializer, typename ValueSerializer>
+bool LRUCache<K, V, Policy, Stats>::LoadSnapshot(const std::string& path) {
+    SnapshotEntries<K, V> entries;
+    if (!ReadSnapshot<K, V, KeySerializer, ValueSerializer>(path, entries))
+        return false;
+
+    Restore(entries);
+    return true;
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+void LRUCache<K, V, Policy, Stats>::Restore(const SnapshotEntries<K, V>& entries) {
+    // 1. 清空现有条目；策略整体重建，不残留未命中等钩子留下的状态（例如 ARC 的幽灵列表）
+    policy = Policy(max_size);
+    for (auto& [key, entry] : ht)
+        CancelTimer(entry);
+    ht.clear();
+    current_size = 0;
+
+    // 2. 从最后淘汰的条目往前，选出能放下的部分
+    std::vector<size_t> weights(entries.size());
+    size_t first = entries.size();
+    size_t total = 0;
+    for (size_t i = entries.size(); i-- > 0;) {
+        weights[i] = Weigh(entries[i].first, entries[i].second);
+        if (total + weights[i] > max_size)
+            break;
+
+        total = total + weights[i];
+        first = i;
+    }
+
+    // 3. 一次预留空间，按原顺序插入
+    ht.reserve(entries.size() - first);
+    for (size_t i = first; i < entries.size(); ++i) {
+        if (ht.find(entries[i].first) != ht.end())
+            continue;
+        Admit(entries[i].first, entries[i].second, weights[i]);
+    }
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+typename LRUCache<K, V, Policy, Stats>::Iterator LRUCache<K, V, Policy, Stats>::FindLive(const K& key) {
+    auto it = ht.find(key);
+    if (it == ht.end() || !wheel)
+        return it;
+
+    TimerNode<const K*>& timer = it->second.meta->timer;
+    Clock::time_point now = options.now();
+    if (now >= timer.expires_at) {
+        Remove(it);
+        return ht.end();
+    }
+
+    Touch(timer, now);
+    return it;
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+void LRUCache<K, V, Policy, Stats>::Admit(const K& key, const V& data, size_t weight) {
+    auto it = ht.insert_or_assign(key, Entry(key, data, policy.OnInsert(key))).first;
+    current_size = current_size + weight;
+
+    if (!HasMeta())
+        return;
+
+    it->second.meta = std::make_unique<CacheEntryMeta<K>>(&it->first, weight);
+    if (wheel)
+        StartTimer(it->second.meta->timer, data);
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+std::vector<V> LRUCache<K, V, Policy, Stats>::LoadMany(std::span<const K> keys) {
+    if (!options.bulk_source) {
+        std::vector<V> values;
+        values.reserve(keys.size());
+        for (const K& key : keys)
+            values.push_back(TimedLoad([&]() { return data_source(key); }));
+        return values;
+    }
+
+    std::vector<V> values = TimedLoad([&]() { return options.bulk_source(keys); });
+    if (values.size() != keys.size())
+        throw std::length_error("bulk_source returned a different number of values than keys");
+
+    return values;
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+template<typename F>
+auto LRUCache<K, V, Policy, Stats>::TimedLoad(F load) -> decltype(load()) {
+    if constexpr (!Stats::enabled) {
+        return load();
+    } else {
+        using Clock = std::chrono::steady_clock;
+        auto start = Clock::now();
+        try {
+            auto data = load();
+            stats.RecordLoad(Clock::now() - start);
+            return data;
+        } catch (...) {
+            stats.RecordLoadFailure(Clock::now() - start);
+            throw;
+        }
+    }
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+size_t LRUCache<K, V, Policy, Stats>::Weigh(const K& key, const V& value) const {
+    if (!options.weigher)
+        return 1;
+
+    return options.weigher(key, value);
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+size_t LRUCache<K, V, Policy, Stats>::WeightOf(const Entry& entry) const {
+    if (!options.weigher)
+        return 1;
+
+    return entry.meta->weight;
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+void LRUCache<K, V, Policy, Stats>::EvictFor(size_t weight) {
+    while (current_size + weight > max_size) {
+        auto key_to_remove_opt = policy.Victim();
+        if (!key_to_remove_opt.has_value())
+            break;
+
+        // 已过期但尚未回收的受害者按过期移除处理，不交给 on_evict（例如不写入下一层存储）
+        auto victim = ht.find(key_to_remove_opt.value());
+        bool expired = Expired(victim->second, options.now());
+        if (expired)
+            stats.RecordExpiration();
+        else
+            stats.RecordEviction();
+
+        if (!expired && options.on_evict)
+            options.on_evict(victim->first, victim->second.value);
+
+        current_size = current_size - WeightOf(victim->second);
+        CancelTimer(victim->second);
+        ht.erase(victim);
+    }
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+size_t LRUCache<K, V, Policy, Stats>::Cleanup() {
+    size_t removed = 0;
+    if (!wheel)
+        return removed;
+
+    // 时间轮只交出到期的定时器，不扫描其余条目
+    wheel->Advance(options.now(), [this, &removed](TimerNode<const K*>* timer) {
+        Remove(ht.find(*timer->key));
+        removed = removed + 1;
+    });
+
+    return removed;
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+void LRUCache<K, V, Policy, Stats>::StartTimer(TimerNode<const K*>& timer, const V& value) {
+    Clock::duration ttl = options.expiry ? options.expiry(*timer.key, value) : options.expire_after_write;
+    timer.write_deadline = Clock::time_point::max();
+    timer.expires_at = Clock::time_point::max();
+    if (ttl == Clock::duration::max() && options.expire_after_access == Clock::duration::max())
+        return;
+
+    Clock::time_point now = options.now();
+    timer.write_deadline = Deadline(now, ttl);
+    timer.expires_at = std::min(timer.write_deadline, Deadline(now, options.expire_after_access));
+    wheel->Schedule(&timer);
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+void LRUCache<K, V, Policy, Stats>::Touch(TimerNode<const K*>& timer, Clock::time_point now) {
+    if (options.expire_after_access == Clock::duration::max())
+        return;
+
+    // 重新调度只是 O(1) 的链表摘除与插入
+    timer.expires_at = std::min(timer.write_deadline, Deadline(now, options.expire_after_access));
+    wheel->Schedule(&timer);
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+bool LRUCache<K, V, Policy, Stats>::Expired(const Entry& entry, Clock::time_point now) const {
+    return wheel && now >= entry.meta->timer.expires_at;
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+void LRUCache<K, V, Policy, Stats>::CancelTimer(Entry& entry) {
+    if (wheel)
+        wheel->Cancel(&entry.meta->timer);
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+void LRUCache<K, V, Policy, Stats>::Remove(Iterator it) {
+    stats.RecordExpiration();
+    policy.OnRemove(it->second.node);
+    current_size = current_size - WeightOf(it->second);
+    CancelTimer(it->second);
+    ht.erase(it);
+}
+
+template<typename K, typename V, typename Policy, typename Stats>
+typename LRUCache<K, V, Policy, Stats>::Clock::time_point
+LRUCache<K, V, Policy, Stats>::Deadline(Clock::time_point now, Clock::duration ttl) {
+    // 避免 now + max() 溢出
+    if (ttl >= Clock::time_point::max() - now)
+        return Clock::time_point::max();
+
+    return now + ttl;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "IntrusiveLRUCache.hpp"
+
+/*
+ * 分片的线程安全 LRU 缓存：
+ * 1. 按键的哈希值把缓存分成 N 个分片，每个分片有独立的锁、时序链表和容量
+ * 2. 不同分片上的访问互不阻塞，锁竞争随分片数下降
+ * 3. 持锁区间只包含哈希表与链表操作，慢速数据源在锁外调用
+ * 4. 淘汰只在分片内部进行，整体是近似的 LRU
+ * 5. 未命中合并（single-flight）：同一个键的第一个未命中者登记一个进行中的占位，
+ *    并发的其他未命中者等待它的 shared_future，而不是重复访问数据源；
+ *    数据源抛出的异常会传递给所有等待者，但不会被缓存
+ *
+ * 注意：数据源内部不能查找正在加载的同一个键，否则会等待自己而死锁
+ *
+ */
+
+template<typename K, typename V>
+class ShardedLRUCache {
+private:
+    // 按缓存行对齐，避免相邻分片的锁产生伪共享
+    struct alignas(64) Shard {
+        std::mutex mtx;
+        IntrusiveLRUCache<K, V> cache;
+
+        // 正在从数据源加载的键
+        std::unordered_map<K, std::shared_future<V>> in_flight;
+
+        explicit Shard(size_t capacity) : mtx(), cache(capacity, nullptr), in_flight() {
+        }
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards;
+    unsigned shard_bits;
+
+    // 慢速数据源
+    std::function<V(const K &)> data_source;
+
+    Shard &ShardFor(const K &key) const;
+
+    // 未命中者访问数据源，并把结果（或异常）发布给等待同一个键的线程
+    V Load(Shard &shard, const K &key, std::promise<V> &promise);
+
+public:
+    // num_shards 会向上取整为 2 的幂（但不超过 max_sz），总容量均分到各个分片，总和恰好为 max_sz
+    ShardedLRUCache(size_t max_sz, std::function<V(const K &)> source, size_t num_shards = 16);
+
+    // 缓存查找函数，可被多个线程同时调用
+    V CacheLookup(const K &key);
+
+    // 各分片条目数之和
+    size_t Size() const;
+
+    size_t ShardCount() const { return shards.size(); }
+};
+
+#include "ShardedLRUCache.tpp"
@@ -0,0 +1,95 @@
+#pragma once
+
+// 构造函数实现
+template<typename K, typename V>
+ShardedLRUCache<K, V>::ShardedLRUCache(size_t max_sz, std::function<V(const K &)> source, size_t num_shards)
+    : shard_bits(0), data_source(std::move(source)) {
+    while ((size_t{1} << shard_bits) < num_shards)
+        shard_bits = shard_bits + 1;
+
+    // 每个分片至少能放下一个条目：分片数不超过 max_sz
+    while (shard_bits > 0 && (size_t{1} << shard_bits) > max_sz)
+        shard_bits = shard_bits - 1;
+
+    // 余数分给前几个分片，各分片容量之和恰好等于 max_sz
+    size_t count = size_t{1} << shard_bits;
+    size_t per_shard = max_sz / count;
+    size_t remainder = max_sz % count;
+
+    shards.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        shards.push_back(std::make_unique<Shard>(per_shard + (i < remainder ? 1 : 0)));
+}
+
+// 缓存查找函数实现
+template<typename K, typename V>
+V ShardedLRUCache<K, V>::CacheLookup(const K &key) {
+    Shard &shard = ShardFor(key);
+    std::unique_lock lock(shard.mtx);
+
+    auto cached = shard.cache.TryLookup(key);
+    if (cached.has_value())
+        return std::move(cached.value());
+
+    // 已有线程在加载该键：释放锁后等待其结果
+    auto it = shard.in_flight.find(key);
+    if (it != shard.in_flight.end()) {
+        std::shared_future<V> pending = it->second;
+        lock.unlock();
+        return pending.get();
+    }
+
+    // 第一个未命中者登记占位，然后在锁外加载
+    std::promise<V> promise;
+    shard.in_flight.emplace(key, promise.get_future().share());
+    lock.unlock();
+
+    return Load(shard, key, promise);
+}
+
+template<typename K, typename V>
+V ShardedLRUCache<K, V>::Load(Shard &shard, const K &key, std::promise<V> &promise) {
+    try {
+        // 在锁外访问慢速数据源，避免其他线程在同一分片上长时间等待
+        V data = data_source(key);
+
+        {
+            // 先写入缓存再撤销占位，之后到达的线程直接命中
+            std::lock_guard lock(shard.mtx);
+            shard.cache.Insert(key, data);
+            shard.in_flight.erase(key);
+        }
+        promise.set_value(data);
+
+        return data;
+    } catch (...) {
+        // 失败不缓存：撤销占位，把异常交给所有等待者
+        {
+            std::lock_guard lock(shard.mtx);
+            shard.in_flight.erase(key);
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+}
+
+template<typename K, typename V>
+size_t ShardedLRUCache<K, V>::Size() const {
+    size_t total = 0;
+    for (const auto &shard: shards) {
+        std::lock_guard lock(shard->mtx);
+        total = total + shard->cache.Size();
+    }
+    return total;
+}
+
+template<typename K, typename V>
+typename ShardedLRUCache<K, V>::Shard &ShardedLRUCache<K, V>::ShardFor(const K &key) const {
+    if (shard_bits == 0)
+        return *shards[0];
+
+    // std::hash 对整数通常是恒等映射，分片内部又用低位选桶；
+    // 先乘以黄金比例常数打散，再取高位作为分片下标
+    uint64_t mixed = static_cast<uint64_t>(std::hash<K>{}(key)) * 0x9E3779B97F4A7C15ULL;
+    return *shards[mixed >> (64 - shard_bits)];
+}
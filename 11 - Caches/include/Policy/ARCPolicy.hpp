@@ -0,0 +1,91 @@
+#pragma once
+
+#include <list>
+#include <optional>
+#include <unordered_map>
+
+/*
+ * 自适应替换缓存（ARC）策略：
+ * 1. T1：只被访问过一次的常驻键（体现最近性）；T2：至少被访问过两次的常驻键（体现频率）
+ * 2. B1、B2：分别记录最近从 T1、T2 淘汰的键（幽灵列表），只保存键不保存值
+ * 3. 目标值 p 表示 T1 期望的大小：未命中的键出现在 B1 中说明 T1 太小，p 增大；
+ *    出现在 B2 中说明 T2 太小，p 减小
+ * 4. 淘汰时 T1 超过 p 则淘汰 T1 的最久未使用者，否则淘汰 T2 的，被淘汰的键进入对应的幽灵列表
+ * 5. 幽灵列表的总长度受限：|T1| + |B1| <= c，|T1| + |T2| + |B1| + |B2| <= 2c
+ */
+
+enum class ARCList {
+    T1,
+    T2,
+    B1,
+    B2
+};
+
+template<typename K>
+struct ARCNode {
+    K key;
+    ARCList list;
+};
+
+template<typename K>
+class ARCPolicy {
+private:
+    // front 端最久未使用
+    std::list<ARCNode<K>> t1;
+    std::list<ARCNode<K>> t2;
+    std::list<ARCNode<K>> b1;
+    std::list<ARCNode<K>> b2;
+
+    // 幽灵键 -> 它在 B1 或 B2 中的位置
+    std::unordered_map<K, typename std::list<ARCNode<K>>::iterator> ghosts;
+
+    size_t capacity;
+    size_t p;
+
+    // 最近一次未命中的键是否命中了幽灵列表（T1 表示不在幽灵列表中），
+    // 只作为 Victim 在 |T1| == p 时的取舍依据；过期的值只影响这一次取舍，不影响正确性
+    ARCList pending;
+
+    std::list<ARCNode<K>> &ListOf(ARCList list);
+
+    // 把 list 的最久未使用者移到对应的幽灵列表，返回其键
+    K MoveToGhost(ARCList list);
+
+    void DropGhost(ARCList list);
+
+    void TrimGhosts();
+
+public:
+    using Handle = typename std::list<ARCNode<K>>::iterator;
+
+    // 目标值 p 与幽灵列表的上限按条目数计算
+    static constexpr bool SUPPORTS_WEIGHER = false;
+
+    explicit ARCPolicy(size_t capacity) : capacity(capacity), p(0), pending(ARCList::T1) {}
+
+    // 根据幽灵列表命中情况调整目标值 p
+    void OnMiss(const K &key);
+
+    Handle OnInsert(const K &key);
+
+    void OnHit(Handle &node);
+
+    std::optional<K> Victim();
+
+    // 主动移除的键不进入幽灵列表：它不是因为容量不足而离开的
+    void OnRemove(Handle &node);
+
+    // 先 T1 后 T2，幽灵列表中的键不在缓存中，不包括在内
+    template<typename F>
+    void ForEach(F f) const {
+        for (const auto &node: t1)
+            f(node.key);
+        for (const auto &node: t2)
+            f(node.key);
+    }
+
+    // 当前 T1 的目标大小，便于观察自适应过程
+    size_t Target() const { return p; }
+};
+
+#include "ARCPolicy.tpp"
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+
+template<typename K>
+void ARCPolicy<K>::OnMiss(const K &key) {
+    pending = ARCList::T1;
+
+    auto it = ghosts.find(key);
+    if (it == ghosts.end())
+        return;
+
+    pending = it->second->list;
+    if (pending == ARCList::B1) {
+        // 最近性不足：增大 T1 的目标大小
+        size_t delta = std::max<size_t>(1, b2.size() / b1.size());
+        p = std::min(capacity, p + delta);
+    } else {
+        // 频率不足：减小 T1 的目标大小
+        size_t delta = std::max<size_t>(1, b1.size() / b2.size());
+        p = p > delta ? p - delta : 0;
+    }
+}
+
+template<typename K>
+typename ARCPolicy<K>::Handle ARCPolicy<K>::OnInsert(const K &key) {
+    Handle node;
+
+    // 按键查幽灵列表，不依赖 OnMiss 留下的状态：OnMiss 之后不一定紧跟着同一个键的 OnInsert
+    auto it = ghosts.find(key);
+    if (it == ghosts.end()) {
+        t1.push_back(ARCNode<K>{key, ARCList::T1});
+        node = std::prev(t1.end());
+    } else {
+        // 幽灵命中：说明该键被访问过不止一次，直接进入 T2
+        node = it->second;
+        ghosts.erase(it);
+
+        std::list<ARCNode<K>> &from = ListOf(node->list);
+        node->list = ARCList::T2;
+        t2.splice(t2.end(), from, node);
+    }
+
+    pending = ARCList::T1;
+    TrimGhosts();
+    return node;
+}
+
+template<typename K>
+void ARCPolicy<K>::OnHit(Handle &node) {
+    // 无论在 T1 还是 T2 中命中，都移到 T2 的尾部
+    std::list<ARCNode<K>> &from = ListOf(node->list);
+    node->list = ARCList::T2;
+    t2.splice(t2.end(), from, node);
+}
+
+template<typename K>
+std::optional<K> ARCPolicy<K>::Victim() {
+    if (t1.empty() && t2.empty())
+        return std::nullopt;
+
+    bool from_t1 = !t1.empty() &&
+                   (t1.size() > p || (pending == ARCList::B2 && t1.size() == p) || t2.empty());
+
+    return MoveToGhost(from_t1 ? ARCList::T1 : ARCList::T2);
+}
+
+template<typename K>
+void ARCPolicy<K>::OnRemove(Handle &node) {
+    ListOf(node->list).erase(node);
+}
+
+template<typename K>
+std::list<ARCNode<K>> &ARCPolicy<K>::ListOf(ARCList list) {
+    switch (list) {
+        case ARCList::T1:
+            return t1;
+        case ARCList::T2:
+            return t2;
+        case ARCList::B1:
+            return b1;
+        default:
+            return b2;
+    }
+}
+
+template<typename K>
+K ARCPolicy<K>::MoveToGhost(ARCList list) {
+    std::list<ARCNode<K>> &from = ListOf(list);
+    ARCList ghost_list = list == ARCList::T1 ? ARCList::B1 : ARCList::B2;
+    std::list<ARCNode<K>> &to = ListOf(ghost_list);
+
+    auto node = from.begin();
+    node->list = ghost_list;
+    to.splice(to.end(), from, node);
+    ghosts[node->key] = node;
+
+    return node->key;
+}
+
+template<typename K>
+void ARCPolicy<K>::DropGhost(ARCList list) {
+    std::list<ARCNode<K>> &ghost = ListOf(list);
+    ghosts.erase(ghost.front().key);
+    ghost.pop_front();
+}
+
+template<typename K>
+void ARCPolicy<K>::TrimGhosts() {
+    while (t1.size() + b1.size() > capacity && !b1.empty())
+        DropGhost(ARCList::B1);
+
+    while (t1.size() + t2.size() + b1.size() + b2.size() > 2 * capacity) {
+        if (!b2.empty())
+            DropGhost(ARCList::B2);
+        else if (!b1.empty())
+            DropGhost(ARCList::B1);
+        else
+            break;
+    }
+}
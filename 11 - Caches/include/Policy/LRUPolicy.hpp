@@ -0,0 +1,52 @@
+#pragma once
+
+#include <optional>
+#include "../Queue/queue.hpp"
+
+/*
+ * 淘汰策略接口（编译期多态，不使用虚函数）：
+ * - Handle：缓存条目中保存的策略私有数据
+ * - 构造函数接收缓存容量
+ * - OnMiss(key)：未命中时、淘汰之前调用
+ * - OnInsert(key)：新键进入缓存，返回它的 Handle
+ * - OnHit(handle)：命中时调用，可以修改 handle
+ * - Victim()：选出一个要淘汰的键并从策略内部结构中移除，没有可淘汰的键时返回 std::nullopt
+ * - OnRemove(handle)：条目因过期等原因被缓存主动移除，策略只需丢弃它，不视为淘汰
+ * - ForEach(f)：按淘汰的先后（最先淘汰的在前）对每个常驻键调用 f(key)，用于保存快照
+ * - SUPPORTS_WEIGHER：策略内部是否不依赖条目数。设置了 weigher 时容量是总权重，
+ *   按条目数划分区域的策略（SLRU 的保护段、ARC 的目标值与幽灵列表）会算错，缓存构造时拒绝这种组合
+ *
+ * LRUPolicy 即原有行为：用 Queue 维护访问时序，淘汰队首
+ */
+
+template<typename K>
+class LRUPolicy {
+private:
+    Queue<K> q;
+
+public:
+    using Handle = QueueListNode<K> *;
+
+    // 只维护访问时序，不使用容量
+    static constexpr bool SUPPORTS_WEIGHER = true;
+
+    explicit LRUPolicy(size_t) {}
+
+    void OnMiss(const K &) {}
+
+    Handle OnInsert(const K &key);
+
+    void OnHit(Handle &node);
+
+    std::optional<K> Victim();
+
+    void OnRemove(Handle &node);
+
+    template<typename F>
+    void ForEach(F f) const {
+        for (const QueueListNode<K> *node = q.front; node != nullptr; node = node->next)
+            f(node->value);
+    }
+};
+
+#include "LRUPolicy.tpp"
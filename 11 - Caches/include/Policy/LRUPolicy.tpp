@@ -0,0 +1,29 @@
+#pragma once
+
+template<typename K>
+typename LRUPolicy<K>::Handle LRUPolicy<K>::OnInsert(const K &key) {
+    Enqueue(q, key);
+    return q.back;
+}
+
+template<typename K>
+void LRUPolicy<K>::OnHit(Handle &node) {
+    // 重置该键在队列中的位置：移除旧节点后重新入队
+    K key = node->value;
+    RemoveNode(q, node);
+    Enqueue(q, key);
+
+    // 更新缓存条目中的节点指针
+    node = q.back;
+}
+
+template<typename K>
+std::optional<K> LRUPolicy<K>::Victim() {
+    return Dequeue(q);
+}
+
+template<typename K>
+void LRUPolicy<K>::OnRemove(Handle &node) {
+    RemoveNode(q, node);
+    node = nullptr;
+}
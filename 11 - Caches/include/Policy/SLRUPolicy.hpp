@@ -0,0 +1,57 @@
+#pragma once
+
+#include <list>
+#include <optional>
+
+/*
+ * 分段 LRU（SLRU）策略：
+ * 1. 新键进入试用段（probation）
+ * 2. 试用段中的键再次被访问时晋升到保护段（protected，约占容量 80%）
+ * 3. 保护段溢出时，其最久未使用者降级回试用段的尾部
+ * 4. 淘汰优先选试用段的最久未使用者，只访问过一次的键最先离开
+ * 段标记存放在链表节点中，降级其他条目时无需修改它们在缓存中的 Handle
+ */
+
+template<typename K>
+struct SLRUNode {
+    K key;
+    bool is_protected;
+};
+
+template<typename K>
+class SLRUPolicy {
+private:
+    // front 端最久未使用
+    std::list<SLRUNode<K>> probation;
+    std::list<SLRUNode<K>> protected_segment;
+    size_t protected_size;
+
+public:
+    using Handle = typename std::list<SLRUNode<K>>::iterator;
+
+    // 保护段的大小按条目数计算
+    static constexpr bool SUPPORTS_WEIGHER = false;
+
+    explicit SLRUPolicy(size_t capacity) : protected_size(capacity * 4 / 5) {}
+
+    void OnMiss(const K &) {}
+
+    Handle OnInsert(const K &key);
+
+    void OnHit(Handle &node);
+
+    std::optional<K> Victim();
+
+    void OnRemove(Handle &node);
+
+    // 先试用段后保护段，与 Victim 的顺序一致
+    template<typename F>
+    void ForEach(F f) const {
+        for (const auto &node: probation)
+            f(node.key);
+        for (const auto &node: protected_segment)
+            f(node.key);
+    }
+};
+
+#include "SLRUPolicy.tpp"
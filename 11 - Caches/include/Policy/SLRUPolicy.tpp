@@ -0,0 +1,53 @@
+#pragma once
+
+#include <iterator>
+
+template<typename K>
+typename SLRUPolicy<K>::Handle SLRUPolicy<K>::OnInsert(const K &key) {
+    probation.push_back(SLRUNode<K>{key, false});
+    return std::prev(probation.end());
+}
+
+template<typename K>
+void SLRUPolicy<K>::OnHit(Handle &node) {
+    // splice 只移动节点，迭代器保持有效，无需分配内存
+    if (node->is_protected) {
+        protected_segment.splice(protected_segment.end(), protected_segment, node);
+        return;
+    }
+
+    if (protected_size == 0) {
+        probation.splice(probation.end(), probation, node);
+        return;
+    }
+
+    // 晋升到保护段
+    node->is_protected = true;
+    protected_segment.splice(protected_segment.end(), probation, node);
+
+    // 保护段溢出：最久未使用者降级回试用段
+    if (protected_segment.size() > protected_size) {
+        auto demoted = protected_segment.begin();
+        demoted->is_protected = false;
+        probation.splice(probation.end(), protected_segment, demoted);
+    }
+}
+
+template<typename K>
+std::optional<K> SLRUPolicy<K>::Victim() {
+    std::list<SLRUNode<K>> &segment = probation.empty() ? protected_segment : probation;
+    if (segment.empty())
+        return std::nullopt;
+
+    K key = segment.front().key;
+    segment.pop_front();
+    return key;
+}
+
+template<typename K>
+void SLRUPolicy<K>::OnRemove(Handle &node) {
+    if (node->is_protected)
+        protected_segment.erase(node);
+    else
+        probation.erase(node);
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+
+/*
+ * 有界多生产者多消费者队列（Vyukov 环形缓冲区）：
+ * 1. 容量向上取整为 2 的幂，下标用位与取模；所有槽在构造时一次分配，入队出队不再分配内存
+ * 2. 每个槽带一个序号：序号等于入队位置时槽空闲，等于入队位置 + 1 时槽中有值；
+ *    生产者和消费者各自用 CAS 抢占位置，抢到后独占该槽，写完再发布序号，全程无锁
+ * 3. 入队位置、出队位置各占一条缓存行，生产者与消费者不会因为伪共享互相拖慢
+ * 4. Try* 在队列满/空时立即返回；Enqueue/Dequeue 先自旋、再让出 CPU，多次失败后用 std::atomic::wait 睡眠，
+ *    对方发布槽时唤醒，长时间满/空不会占用 CPU；没有线程睡眠时，发布方只是以 seq_cst 写序号并多读一次睡眠计数
+ * 5. 批量操作一次 CAS 抢占连续的多个槽，减少竞争
+ * 抢到槽之后拷贝或移动值的过程不能失败，因此 V 的拷贝/移动构造不应抛出异常
+ *
+ */
+
+template<typename V>
+class BoundedMPMCQueue {
+public:
+    explicit BoundedMPMCQueue(size_t capacity);
+
+    // 禁用拷贝：其他线程可能正在访问槽
+    BoundedMPMCQueue(const BoundedMPMCQueue &) = delete;
+
+    BoundedMPMCQueue &operator=(const BoundedMPMCQueue &) = delete;
+
+    // 析构时队列中剩余的值一并析构，此时不能再有其他线程访问队列
+    ~BoundedMPMCQueue();
+
+    // 队列满时返回 false
+    bool TryEnqueue(const V &value);
+
+    bool TryEnqueue(V &&value);
+
+    // 队列空时返回 std::nullopt
+    std::optional<V> TryDequeue();
+
+    // 队列满时等待
+    void Enqueue(V value);
+
+    // 队列空时等待
+    V Dequeue();
+
+    // 尽量多地入队 values 的前缀，返回入队的个数
+    size_t TryEnqueueBatch(std::span<const V> values);
+
+    // 尽量多地出队到 out 中，返回出队的个数
+    size_t TryDequeueBatch(std::span<V> out);
+
+    // 全部入队后返回
+    void EnqueueBatch(std::span<const V> values);
+
+    // 至少出队一个后返回，返回出队的个数
+    size_t DequeueBatch(std::span<V> out);
+
+    size_t Capacity() const { return mask + 1; }
+
+    // 近似的元素个数，其他线程同时操作时仅供参考
+    size_t SizeApprox() const;
+
+private:
+    static constexpr size_t CACHE_LINE = 64;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        alignas(V) unsigned char storage[sizeof(V)];
+
+        V *Value() { return reinterpret_cast<V *>(storage); }
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+
+    alignas(CACHE_LINE) std::atomic<size_t> enqueue_pos;
+    alignas(CACHE_LINE) std::atomic<size_t> dequeue_pos;
+
+    // 抢占最多 count 个连续的空闲槽，返回起始位置与个数（个数为 0 表示队列已满）
+    size_t ClaimEnqueue(size_t count, size_t &pos);
+
+    // 抢占最多 count 个连续的有值的槽（个数为 0 表示队列为空）
+    size_t ClaimDequeue(size_t count, size_t &pos);
+
+    // 自旋的次数，之后让出 CPU 的次数，都用完后睡眠
+    static constexpr unsigned SPIN_LIMIT = 64;
+    static constexpr unsigned YIELD_LIMIT = 64;
+
+    // 一个方向上睡眠的线程：not_full 上睡眠的是生产者，not_empty 上睡眠的是消费者
+    struct alignas(CACHE_LINE) Sleepers {
+        // 准备睡眠的线程数，唤醒时清零
+        std::atomic<uint32_t> count{0};
+
+        // 每次唤醒加一，睡眠的线程在它上面等待
+        std::atomic<uint32_t> epoch{0};
+    };
+
+    Sleepers not_full;
+    Sleepers not_empty;
+
+    // 以 seq_cst 发布槽之后调用，有线程睡眠时唤醒它们
+    static void Wake(Sleepers &sleepers);
+
+    // 队列满/空时等待，直到对方发布一个槽
+    void WaitNotFull(unsigned &attempts);
+
+    void WaitNotEmpty(unsigned &attempts);
+
+    // 先自旋、再让出 CPU，多次失败后登记到 sleepers 并睡眠；position 处的槽的序号已不等于位置 - lag（不再满/空）时不睡眠
+    void Backoff(unsigned &attempts, Sleepers &sleepers, const std::atomic<size_t> &position, size_t lag);
+};
+
+#include "BoundedMPMCQueue.tpp"
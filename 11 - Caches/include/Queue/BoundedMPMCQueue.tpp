@@ -0,0 +1,274 @@
+#pragma once
+
+#include <bit>
+#include <new>
+#include <thread>
+#include <utility>
+
+// 构造函数实现
+template<typename V>
+BoundedMPMCQueue<V>::BoundedMPMCQueue(size_t capacity)
+    : mask(std::bit_ceil(capacity < 2 ? size_t{2} : capacity) - 1), enqueue_pos(0), dequeue_pos(0) {
+    cells = std::make_unique<Cell[]>(mask + 1);
+    for (size_t i = 0; i <= mask; ++i)
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template<typename V>
+BoundedMPMCQueue<V>::~BoundedMPMCQueue() {
+    size_t end = enqueue_pos.load(std::memory_order_relaxed);
+    for (size_t pos = dequeue_pos.load(std::memory_order_relaxed); pos != end; ++pos)
+        cells[pos & mask].Value()->~V();
+}
+
+template<typename V>
+bool BoundedMPMCQueue<V>::TryEnqueue(const V &value) {
+    size_t pos = 0;
+    if (ClaimEnqueue(1, pos) == 0)
+        return false;
+
+    Cell &cell = cells[pos & mask];
+    new(cell.storage) V(value);
+    cell.sequence.store(pos + 1, std::memory_order_seq_cst);
+    Wake(not_empty);
+    return true;
+}
+
+template<typename V>
+bool BoundedMPMCQueue<V>::TryEnqueue(V &&value) {
+    size_t pos = 0;
+    if (ClaimEnqueue(1, pos) == 0)
+        return false;
+
+    Cell &cell = cells[pos & mask];
+    new(cell.storage) V(std::move(value));
+    cell.sequence.store(pos + 1, std::memory_order_seq_cst);
+    Wake(not_empty);
+    return true;
+}
+
+template<typename V>
+std::optional<V> BoundedMPMCQueue<V>::TryDequeue() {
+    size_t pos = 0;
+    if (ClaimDequeue(1, pos) == 0)
+        return std::nullopt;
+
+    Cell &cell = cells[pos & mask];
+    std::optional<V> value(std::move(*cell.Value()));
+    cell.Value()->~V();
+
+    // 序号推进一整圈，槽留给下一轮的生产者
+    cell.sequence.store(pos + mask + 1, std::memory_order_seq_cst);
+    Wake(not_full);
+    return value;
+}
+
+template<typename V>
+void BoundedMPMCQueue<V>::Enqueue(V value) {
+    // 只有抢到槽时才会移动 value，失败重试时 value 仍然完整
+    unsigned attempts = 0;
+    while (!TryEnqueue(std::move(value)))
+        WaitNotFull(attempts);
+}
+
+template<typename V>
+V BoundedMPMCQueue<V>::Dequeue() {
+    unsigned attempts = 0;
+    while (true) {
+        std::optional<V> value = TryDequeue();
+        if (value.has_value())
+            return std::move(value.value());
+        WaitNotEmpty(attempts);
+    }
+}
+
+template<typename V>
+size_t BoundedMPMCQueue<V>::TryEnqueueBatch(std::span<const V> values) {
+    size_t pos = 0;
+    size_t count = ClaimEnqueue(values.size(), pos);
+
+    for (size_t i = 0; i < count; ++i) {
+        Cell &cell = cells[(pos + i) & mask];
+        new(cell.storage) V(values[i]);
+        cell.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+
+    // 整批只需一次屏障
+    if (count > 0) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        Wake(not_empty);
+    }
+
+    return count;
+}
+
+template<typename V>
+size_t BoundedMPMCQueue<V>::TryDequeueBatch(std::span<V> out) {
+    size_t pos = 0;
+    size_t count = ClaimDequeue(out.size(), pos);
+
+    for (size_t i = 0; i < count; ++i) {
+        Cell &cell = cells[(pos + i) & mask];
+        out[i] = std::move(*cell.Value());
+        cell.Value()->~V();
+        cell.sequence.store(pos + i + mask + 1, std::memory_order_release);
+    }
+
+    if (count > 0) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        Wake(not_full);
+    }
+
+    return count;
+}
+
+template<typename V>
+void BoundedMPMCQueue<V>::EnqueueBatch(std::span<const V> values) {
+    unsigned attempts = 0;
+    size_t done = 0;
+    while (done < values.size()) {
+        size_t count = TryEnqueueBatch(values.subspan(done));
+        if (count == 0) {
+            WaitNotFull(attempts);
+            continue;
+        }
+
+        done = done + count;
+        attempts = 0;
+    }
+}
+
+template<typename V>
+size_t BoundedMPMCQueue<V>::DequeueBatch(std::span<V> out) {
+    if (out.empty())
+        return 0;
+
+    unsigned attempts = 0;
+    while (true) {
+        size_t count = TryDequeueBatch(out);
+        if (count > 0)
+            return count;
+        WaitNotEmpty(attempts);
+    }
+}
+
+template<typename V>
+size_t BoundedMPMCQueue<V>::SizeApprox() const {
+    size_t head = dequeue_pos.load(std::memory_order_relaxed);
+    size_t tail = enqueue_pos.load(std::memory_order_relaxed);
+    if (tail <= head)
+        return 0;
+
+    return tail - head < mask + 1 ? tail - head : mask + 1;
+}
+
+template<typename V>
+size_t BoundedMPMCQueue<V>::ClaimEnqueue(size_t count, size_t &pos) {
+    if (count == 0)
+        return 0;
+
+    pos = enqueue_pos.load(std::memory_order_relaxed);
+    while (true) {
+        // 从 pos 开始数连续的空闲槽（序号等于各自的位置）
+        size_t free = 0;
+        while (free < count &&
+               cells[(pos + free) & mask].sequence.load(std::memory_order_acquire) == pos + free)
+            free = free + 1;
+
+        if (free == 0) {
+            // 序号落后于 pos：该槽上一轮的值还没被取走，队列已满
+            size_t sequence = cells[pos & mask].sequence.load(std::memory_order_acquire);
+            if (static_cast<std::ptrdiff_t>(sequence - pos) < 0)
+                return 0;
+
+            // 其他生产者已抢走 pos，重新读取
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        // CAS 失败时 pos 被更新为最新的入队位置
+        if (enqueue_pos.compare_exchange_weak(pos, pos + free, std::memory_order_relaxed))
+            return free;
+    }
+}
+
+template<typename V>
+size_t BoundedMPMCQueue<V>::ClaimDequeue(size_t count, size_t &pos) {
+    if (count == 0)
+        return 0;
+
+    pos = dequeue_pos.load(std::memory_order_relaxed);
+    while (true) {
+        // 从 pos 开始数连续的有值的槽（序号等于各自的位置 + 1）
+        size_t ready = 0;
+        while (ready < count &&
+               cells[(pos + ready) & mask].sequence.load(std::memory_order_acquire) == pos + ready + 1)
+            ready = ready + 1;
+
+        if (ready == 0) {
+            // 序号还没到 pos + 1：生产者尚未写入，队列为空
+            size_t sequence = cells[pos & mask].sequence.load(std::memory_order_acquire);
+            if (static_cast<std::ptrdiff_t>(sequence - (pos + 1)) < 0)
+                return 0;
+
+            pos = dequeue_pos.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (dequeue_pos.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed))
+            return ready;
+    }
+}
+
+template<typename V>
+void BoundedMPMCQueue<V>::Wake(Sleepers &sleepers) {
+    // 调用方以 seq_cst 发布槽（或在发布后加 seq_cst 屏障），与 Backoff 中的登记配对：
+    // 要么睡眠方看到刚发布的槽，要么这里看到登记的睡眠方
+    if (sleepers.count.load(std::memory_order_seq_cst) == 0)
+        return;
+
+    // 清零后，后续的发布不再重复唤醒已经被唤醒的线程
+    if (sleepers.count.exchange(0, std::memory_order_relaxed) == 0)
+        return;
+
+    sleepers.epoch.fetch_add(1, std::memory_order_release);
+    sleepers.epoch.notify_all();
+}
+
+template<typename V>
+void BoundedMPMCQueue<V>::WaitNotFull(unsigned &attempts) {
+    // 队列满时入队位置上的槽还存着上一轮的值，序号比位置小 mask，直到消费者取走它
+    Backoff(attempts, not_full, enqueue_pos, mask);
+}
+
+template<typename V>
+void BoundedMPMCQueue<V>::WaitNotEmpty(unsigned &attempts) {
+    // 队列空时出队位置上的槽序号等于位置，直到生产者写入
+    Backoff(attempts, not_empty, dequeue_pos, 0);
+}
+
+template<typename V>
+void BoundedMPMCQueue<V>::Backoff(unsigned &attempts, Sleepers &sleepers, const std::atomic<size_t> &position,
+                                  size_t lag) {
+    // 短暂的满/空通常很快解除：先自旋，再让出 CPU 给持有槽的线程，都避免睡眠和唤醒的系统调用；
+    // 单核或过载时持续自旋只会拖慢对方，因此很快改为让出
+    if (attempts < SPIN_LIMIT) {
+        attempts = attempts + 1;
+        return;
+    }
+    if (attempts < SPIN_LIMIT + YIELD_LIMIT) {
+        attempts = attempts + 1;
+        std::this_thread::yield();
+        return;
+    }
+
+    // 先登记再检查，与 Wake 配对：检查之后发布的槽一定会唤醒这里
+    sleepers.count.fetch_add(1, std::memory_order_seq_cst);
+    uint32_t epoch = sleepers.epoch.load(std::memory_order_acquire);
+
+    size_t pos = position.load(std::memory_order_relaxed);
+    if (cells[pos & mask].sequence.load(std::memory_order_seq_cst) != pos - lag)
+        return;
+
+    sleepers.epoch.wait(epoch, std::memory_order_acquire);
+}
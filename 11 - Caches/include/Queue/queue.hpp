@@ -1,5 +1,6 @@
 #pragma once
 #include <optional>
+#include <utility>
 
 template<typename V>
 struct QueueListNode {
@@ -17,6 +18,19 @@ struct Queue {
     QueueListNode<V> *back;
 
     Queue(): front(nullptr), back(nullptr) {}
+
+    // 禁用拷贝：节点由队列持有；移动时交换节点，原有节点随被移动的对象释放
+    Queue(const Queue&) = delete;
+
+    Queue& operator=(const Queue&) = delete;
+
+    Queue(Queue&& other) noexcept : front(std::exchange(other.front, nullptr)), back(std::exchange(other.back, nullptr)) {}
+
+    Queue& operator=(Queue&& other) noexcept {
+        std::swap(front, other.front);
+        std::swap(back, other.back);
+        return *this;
+    }
     
     ~Queue() {
         while (front != nullptr) {
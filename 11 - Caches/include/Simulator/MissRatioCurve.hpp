@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * 一次遍历计算 LRU 的未命中率曲线（Miss Ratio Curve）：
+ * 1. 栈距离：一次访问的栈距离是它与同一个键上一次访问之间出现过的不同键的个数，
+ *    容量为 c 的 LRU 缓存命中当且仅当栈距离 < c，所以一张栈距离直方图即可给出所有容量的未命中率
+ * 2. 每个键只在它最近一次访问的时间点上记 1，用树状数组（Fenwick tree）统计区间和，
+ *    每次访问 O(log n)；时间点用完时把仍然有效的时间点重新编号压缩
+ * 3. SHARDS 采样：只处理哈希值落在采样区间内的键，栈距离按 1 / rate 放大；
+ *    并按期望采样数修正第一个桶（SHARDS-adj），减小采样数偏离期望带来的误差
+ *
+ */
+
+class MissRatioCurve {
+public:
+    // sampling_rate 取 (0, 1]，1 表示不采样、结果精确
+    explicit MissRatioCurve(double sampling_rate = 1.0);
+
+    void Access(uint64_t key);
+
+    // 容量为 size 的 LRU 缓存的未命中率
+    double MissRatio(size_t size) const;
+
+    // 访问总数（包括未被采样的访问）
+    uint64_t Accesses() const { return accesses; }
+
+    uint64_t SampledAccesses() const { return sampled; }
+
+    // 采样键中不同键的个数按采样率放大，即缓存能用到的最大容量的估计
+    size_t DistinctKeys() const;
+
+private:
+    double rate;
+    uint64_t threshold;
+
+    uint64_t accesses;
+    uint64_t sampled;
+    uint64_t cold_misses;
+
+    // distances[d]：栈距离为 d 的（采样）访问次数
+    std::vector<uint64_t> distances;
+
+    // 键 -> 最近一次访问的时间点
+    std::unordered_map<uint64_t, uint64_t> last_access;
+
+    // 树状数组，下标从 1 开始
+    std::vector<int64_t> tree;
+    uint64_t clock;
+
+    void Add(uint64_t time, int64_t delta);
+
+    // 时间点 [1, time] 中仍然有效的个数
+    int64_t Prefix(uint64_t time) const;
+
+    // 重新编号所有有效的时间点，并按需要扩大树状数组
+    void Compact();
+
+    static uint64_t Mix(uint64_t key);
+};
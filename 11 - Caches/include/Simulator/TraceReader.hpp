@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/*
+ * 访问轨迹（trace）的流式读取，整个文件不会被读入内存：
+ * 1. Text：每行一个键；十进制整数直接作为键，其余内容取 FNV-1a 哈希；忽略空行和以 # 开头的行
+ * 2. Binary：连续的 8 字节小端无符号整数
+ *
+ */
+
+enum class TraceFormat {
+    Text,
+    Binary
+};
+
+class TraceReader {
+public:
+    TraceReader(const std::string &path, TraceFormat format);
+
+    TraceReader(const TraceReader &) = delete;
+
+    TraceReader &operator=(const TraceReader &) = delete;
+
+    bool IsOpen() const { return in.is_open(); }
+
+    // 读取下一个键，到达文件末尾时返回 false
+    bool Next(uint64_t &key);
+
+    // 已读取的键的个数
+    uint64_t Count() const { return count; }
+
+private:
+    std::vector<char> buffer;
+    std::ifstream in;
+    TraceFormat format;
+    std::string line;
+    uint64_t count;
+
+    bool NextText(uint64_t &key);
+
+    bool NextBinary(uint64_t &key);
+
+    static uint64_t HashLine(const std::string &text);
+};
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+/*
+ * 快照的序列化：
+ * 1. SnapshotWriter / SnapshotReader 包装文件流或一段内存，并对经过的每个字节计算 FNV-1a 校验和
+ * 2. Serializer<T> 负责一种类型的读写，默认支持算术类型（按主机字节序原样写出）和 std::string（长度 + 内容），
+ *    其他类型通过特化 Serializer<T> 接入：
+ *
+ *    template<>
+ *    struct Serializer<Point> {
+ *        static void Write(SnapshotWriter &out, const Point &p) { ... }
+ *        static bool Read(SnapshotReader &in, Point &p) { ... }
+ *    };
+ *
+ */
+
+class SnapshotWriter {
+public:
+    explicit SnapshotWriter(std::ostream &out) : out(&out), data(nullptr), size(0), written(0), checksum(FNV_OFFSET) {}
+
+    // 直接写入 [data, data + size)，超出范围时 Good() 为 false；data 为空时只统计长度和校验和
+    SnapshotWriter(char *data, size_t size) : out(nullptr), data(data), size(size), written(0), checksum(FNV_OFFSET) {}
+
+    void Bytes(const void *bytes, size_t count) {
+        auto p = static_cast<const unsigned char *>(bytes);
+        for (size_t i = 0; i < count; ++i)
+            checksum = (checksum ^ p[i]) * FNV_PRIME;
+
+        if (out != nullptr)
+            out->write(static_cast<const char *>(bytes), static_cast<std::streamsize>(count));
+        else if (data != nullptr && written + count <= size)
+            std::memcpy(data + written, bytes, count);
+        written = written + count;
+    }
+
+    uint64_t Checksum() const { return checksum; }
+
+    // 已经写出的字节数
+    size_t Written() const { return written; }
+
+    bool Good() const {
+        if (out != nullptr)
+            return out->good();
+        return data == nullptr || written <= size;
+    }
+
+private:
+    static constexpr uint64_t FNV_OFFSET = 14695981039346656037ULL;
+    static constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+    std::ostream *out;
+    char *data;
+    size_t size;
+    size_t written;
+    uint64_t checksum;
+};
+
+class SnapshotReader {
+public:
+    explicit SnapshotReader(std::istream &in) : in(&in), data(nullptr), size(0), position(0), checksum(FNV_OFFSET) {}
+
+    // 直接从 [data, data + size) 读取，不经过流
+    SnapshotReader(const char *data, size_t size) : in(nullptr), data(data), size(size), position(0), checksum(FNV_OFFSET) {}
+
+    // 读取失败（文件提前结束）时返回 false
+    bool Bytes(void *bytes, size_t count) {
+        if (in != nullptr) {
+            if (!in->read(static_cast<char *>(bytes), static_cast<std::streamsize>(count)))
+                return false;
+        } else {
+            if (count > size - position)
+                return false;
+            std::memcpy(bytes, data + position, count);
+            position = position + count;
+        }
+
+        auto p = static_cast<const unsigned char *>(bytes);
+        for (size_t i = 0; i < count; ++i)
+            checksum = (checksum ^ p[i]) * FNV_PRIME;
+        return true;
+    }
+
+    uint64_t Checksum() const { return checksum; }
+
+    // 是否已经读到文件末尾
+    bool AtEnd() {
+        if (in != nullptr)
+            return in->peek() == std::istream::traits_type::eof();
+        return position == size;
+    }
+
+private:
+    static constexpr uint64_t FNV_OFFSET = 14695981039346656037ULL;
+    static constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+    std::istream *in;
+    const char *data;
+    size_t size;
+    size_t position;
+    uint64_t checksum;
+};
+
+template<typename T, typename Enable = void>
+struct Serializer;
+
+template<typename T>
+struct Serializer<T, std::enable_if_t<std::is_arithmetic_v<T>>> {
+    static void Write(SnapshotWriter &out, const T &value) {
+        out.Bytes(&value, sizeof(T));
+    }
+
+    static bool Read(SnapshotReader &in, T &value) {
+        return in.Bytes(&value, sizeof(T));
+    }
+};
+
+template<>
+struct Serializer<std::string> {
+    static void Write(SnapshotWriter &out, const std::string &value) {
+        uint64_t size = value.size();
+        out.Bytes(&size, sizeof(size));
+        out.Bytes(value.data(), value.size());
+    }
+
+    static bool Read(SnapshotReader &in, std::string &value) {
+        uint64_t size = 0;
+        if (!in.Bytes(&size, sizeof(size)))
+            return false;
+
+        // 分块读取：损坏的长度字段不会导致一次性分配巨大的内存
+        constexpr uint64_t CHUNK = 64 * 1024;
+        value.clear();
+        while (size > 0) {
+            size_t part = static_cast<size_t>(std::min(size, CHUNK));
+            size_t offset = value.size();
+            value.resize(offset + part);
+            if (!in.Bytes(value.data() + offset, part))
+                return false;
+            size = size - part;
+        }
+        return true;
+    }
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "Serializer.hpp"
+
+/*
+ * 缓存快照文件：
+ * 1. 文件头：8 字节魔数、4 字节版本号、8 字节条目数、8 字节校验和（对版本号、条目数和全部条目计算 FNV-1a）
+ * 2. 之后依次是每个条目的键和值，顺序由调用方决定（LRUCache 按最先淘汰到最后淘汰的顺序保存）
+ * 3. 写入时先写到 path + ".tmp"，完成后再重命名，进程中途退出不会留下半个快照
+ * 4. 读取时魔数、版本、条目数、校验和任何一项不符，或者文件有多余的内容，都拒绝整个快照
+ *
+ * 写入只依赖条目的副本，可以在后台线程中进行，不必持有缓存
+ */
+
+template<typename K, typename V>
+using SnapshotEntries = std::vector<std::pair<K, V>>;
+
+// 成功时返回 true
+template<typename K, typename V, typename KeySerializer = Serializer<K>, typename ValueSerializer = Serializer<V>>
+bool WriteSnapshot(const std::string &path, const SnapshotEntries<K, V> &entries);
+
+// 成功时返回 true 并替换 entries 的内容，失败时 entries 不变
+template<typename K, typename V, typename KeySerializer = Serializer<K>, typename ValueSerializer = Serializer<V>>
+bool ReadSnapshot(const std::string &path, SnapshotEntries<K, V> &entries);
+
+#include "Snapshot.tpp"
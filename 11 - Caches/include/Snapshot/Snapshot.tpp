@@ -0,0 +1,114 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+// 文件格式常量
+struct SnapshotFormat {
+    static constexpr char MAGIC[8] = {'L', 'R', 'U', 'S', 'N', 'A', 'P', '\0'};
+    static constexpr uint32_t VERSION = 2;
+
+    // 校验和字段在文件中的偏移
+    static constexpr std::streamoff CHECKSUM_OFFSET = sizeof(MAGIC) + sizeof(uint32_t) + sizeof(uint64_t);
+};
+
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+bool WriteSnapshot(const std::string &path, const SnapshotEntries<K, V> &entries) {
+    std::string temp_path = path + ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+
+        // 1. 文件头，版本号和条目数计入校验和，校验和先占位
+        uint32_t version = SnapshotFormat::VERSION;
+        uint64_t count = entries.size();
+        uint64_t checksum = 0;
+        out.write(SnapshotFormat::MAGIC, sizeof(SnapshotFormat::MAGIC));
+        SnapshotWriter writer(out);
+        writer.Bytes(&version, sizeof(version));
+        writer.Bytes(&count, sizeof(count));
+        out.write(reinterpret_cast<const char *>(&checksum), sizeof(checksum));
+
+        // 2. 流式写出条目
+        for (const auto &[key, value]: entries) {
+            KeySerializer::Write(writer, key);
+            ValueSerializer::Write(writer, value);
+        }
+
+        // 3. 回填校验和
+        checksum = writer.Checksum();
+        out.seekp(SnapshotFormat::CHECKSUM_OFFSET);
+        out.write(reinterpret_cast<const char *>(&checksum), sizeof(checksum));
+        out.flush();
+
+        if (!out) {
+            out.close();
+            std::error_code ignored;
+            std::filesystem::remove(temp_path, ignored);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temp_path, path, error);
+    if (error) {
+        std::filesystem::remove(temp_path, error);
+        return false;
+    }
+
+    return true;
+}
+
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+bool ReadSnapshot(const std::string &path, SnapshotEntries<K, V> &entries) {
+    std::error_code error;
+    uint64_t file_size = std::filesystem::file_size(path, error);
+    if (error)
+        return false;
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        return false;
+
+    // 1. 校验文件头
+    char magic[sizeof(SnapshotFormat::MAGIC)];
+    uint32_t version = 0;
+    uint64_t count = 0;
+    uint64_t checksum = 0;
+    SnapshotReader reader(in);
+    in.read(magic, sizeof(magic));
+    reader.Bytes(&version, sizeof(version));
+    reader.Bytes(&count, sizeof(count));
+    in.read(reinterpret_cast<char *>(&checksum), sizeof(checksum));
+    if (!in || std::memcmp(magic, SnapshotFormat::MAGIC, sizeof(magic)) != 0 ||
+        version != SnapshotFormat::VERSION)
+        return false;
+
+    // 每个条目至少占 1 个字节，条目数不可能超过文件大小，避免按损坏的条目数预留内存
+    if (count > file_size)
+        return false;
+
+    // 2. 读出全部条目，校验通过后才交给调用方
+    // 条目数要读完才能被校验和确认，预留的内存不超过文件大小，更多的条目随读取增长
+    SnapshotEntries<K, V> loaded;
+    loaded.reserve(static_cast<size_t>(std::min<uint64_t>(count, file_size / sizeof(std::pair<K, V>))));
+
+    for (uint64_t i = 0; i < count; ++i) {
+        K key{};
+        V value{};
+        if (!KeySerializer::Read(reader, key) || !ValueSerializer::Read(reader, value))
+            return false;
+        loaded.emplace_back(std::move(key), std::move(value));
+    }
+
+    if (!reader.AtEnd() || reader.Checksum() != checksum)
+        return false;
+
+    entries = std::move(loaded);
+    return true;
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "LatencyHistogram.hpp"
+
+/*
+ * 缓存统计（作为 LRUCache 的模板参数 Stats）：
+ * 1. NullCacheStats（默认）：所有记录函数都是空的内联函数，且是空类型，
+ *    配合 [[no_unique_address]] 不占缓存对象的空间，加载也不计时，统计被完全编译掉
+ * 2. CacheStats：命中、未命中、淘汰、过期、加载次数分散在多个按缓存行对齐的条带中，
+ *    每个线程固定写一个条带，避免多个线程争用同一个计数器
+ * 3. 数据源的调用耗时（纳秒）记录在对数-线性直方图中
+ * 4. Snapshot 汇总所有条带，可以在其他线程中随时调用
+ *
+ */
+
+struct CacheStatsSnapshot {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    uint64_t expirations = 0;
+    uint64_t loads = 0;
+    uint64_t load_failures = 0;
+
+    // 数据源每次调用的耗时，单位纳秒（批量加载计为一次调用）
+    HistogramSnapshot load_latency;
+
+    double HitRatio() const;
+};
+
+class NullCacheStats {
+public:
+    static constexpr bool enabled = false;
+
+    void RecordHit() {}
+
+    void RecordMiss() {}
+
+    void RecordEviction() {}
+
+    void RecordExpiration() {}
+
+    void RecordLoad(std::chrono::nanoseconds) {}
+
+    void RecordLoadFailure(std::chrono::nanoseconds) {}
+};
+
+class CacheStats {
+public:
+    static constexpr bool enabled = true;
+
+    CacheStats() = default;
+
+    CacheStats(const CacheStats &) = delete;
+
+    CacheStats &operator=(const CacheStats &) = delete;
+
+    void RecordHit() { Increment(&Stripe::hits); }
+
+    void RecordMiss() { Increment(&Stripe::misses); }
+
+    void RecordEviction() { Increment(&Stripe::evictions); }
+
+    void RecordExpiration() { Increment(&Stripe::expirations); }
+
+    void RecordLoad(std::chrono::nanoseconds elapsed);
+
+    void RecordLoadFailure(std::chrono::nanoseconds elapsed);
+
+    CacheStatsSnapshot Snapshot() const;
+
+private:
+    static constexpr size_t STRIPES = 16;
+
+    struct alignas(64) Stripe {
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> evictions{0};
+        std::atomic<uint64_t> expirations{0};
+        std::atomic<uint64_t> loads{0};
+        std::atomic<uint64_t> load_failures{0};
+    };
+
+    Stripe stripes[STRIPES];
+    LatencyHistogram load_latency;
+
+    // 线程第一次记录时按轮转分配条带，之后固定不变
+    inline static std::atomic<size_t> next_stripe{0};
+
+    static size_t StripeIndex() {
+        thread_local size_t index = next_stripe.fetch_add(1, std::memory_order_relaxed) % STRIPES;
+        return index;
+    }
+
+    void Increment(std::atomic<uint64_t> Stripe::*counter) {
+        (stripes[StripeIndex()].*counter).fetch_add(1, std::memory_order_relaxed);
+    }
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/*
+ * 对数-线性（HDR 风格）延迟直方图：
+ * 1. 小于 32 的值每个值一个桶；之后每个 2 的幂区间再均分为 32 个桶，
+ *    因此任何记录值的相对误差不超过 1/32（约 3%），覆盖整个 uint64 范围只需 1920 个桶
+ * 2. Record 只是一次无锁的计数器自增，可以在多个线程中同时调用
+ * 3. Snapshot 复制当前的计数，之后在副本上计算百分位数
+ *
+ */
+
+class HistogramSnapshot {
+public:
+    HistogramSnapshot() : total(0), sum(0) {}
+
+    HistogramSnapshot(std::vector<uint64_t> counts, uint64_t sum);
+
+    uint64_t Count() const { return total; }
+
+    double Mean() const;
+
+    // 第 p 百分位（0 ~ 100）的值，返回所在桶的上界；没有记录时返回 0
+    uint64_t Percentile(double p) const;
+
+    uint64_t Max() const { return Percentile(100.0); }
+
+private:
+    std::vector<uint64_t> counts;
+    uint64_t total;
+    uint64_t sum;
+};
+
+class LatencyHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 5;
+    static constexpr uint64_t SUB_BUCKETS = uint64_t{1} << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKETS = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    LatencyHistogram();
+
+    LatencyHistogram(const LatencyHistogram &) = delete;
+
+    LatencyHistogram &operator=(const LatencyHistogram &) = delete;
+
+    void Record(uint64_t value) {
+        counts[BucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    HistogramSnapshot Snapshot() const;
+
+    static size_t BucketOf(uint64_t value);
+
+    // 桶内可能出现的最大值
+    static uint64_t UpperBound(size_t bucket);
+
+private:
+    std::atomic<uint64_t> counts[BUCKETS];
+    std::atomic<uint64_t> sum;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include "MappedFile.hpp"
+#include "../Snapshot/Serializer.hpp"
+
+/*
+ * 基于文件的缓存层（日志结构）：
+ * 1. 整个文件映射到内存，记录只追加在日志末尾；同一个键再次写入时旧记录变为垃圾，不在原处修改
+ * 2. 内存中的索引保存每个键最新记录的位置；查找只读一条记录，不扫描日志
+ * 3. 每条记录：8 字节校验和（FNV-1a）、8 字节数据长度、序列化后的写入期限、键和值（序列化方式同快照，见 Snapshot/Serializer.hpp，
+ *    直接在映射区上编码和解码）；
+ *    读取时校验和或键不符的记录当作不存在，写入期限已过的记录当作未命中
+ * 4. 文件大小固定为 capacity 字节：日志写到末尾时压缩，按写入顺序丢弃最早的记录直到空出至少四分之一的空间，
+ *    再把剩余的记录依次前移、紧凑排列，同时更新索引，垃圾随之回收
+ * 5. 文件只是缓存的第二层，打开时清空；重启后的预热由快照负责
+ *
+ * 不是线程安全的，由调用方加锁（见 TieredCache）
+ */
+
+template<typename K, typename V, typename KeySerializer = Serializer<K>, typename ValueSerializer = Serializer<V>>
+class FileTier {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    FileTier(const std::string &path, size_t capacity);
+
+    // 文件无法创建或映射时为 false，此时 Put 总是失败、Get 总是未命中
+    bool IsOpen() const { return file.IsOpen(); }
+
+    // 写入或覆盖一个键，write_deadline 之后记录过期；记录大于整个文件时不写入（同时删除该键的旧记录），返回 false
+    bool Put(const K &key, const V &value, Clock::time_point write_deadline = Clock::time_point::max());
+
+    // 按 now 判断是否过期，命中时通过 write_deadline 返回记录的写入期限
+    std::optional<V> Get(const K &key, Clock::time_point now, Clock::time_point &write_deadline) const;
+
+    // 不考虑过期
+    std::optional<V> Get(const K &key) const;
+
+    // 键的个数
+    size_t Size() const { return index.size(); }
+
+    // 有效记录占用的字节数（不含垃圾）
+    size_t LiveBytes() const { return live_bytes; }
+
+    size_t Capacity() const { return file.Size(); }
+
+    // 压缩的次数
+    size_t Compactions() const { return compactions; }
+
+    // 因空间不足在压缩时丢弃的记录数
+    size_t Dropped() const { return dropped; }
+
+private:
+    struct Location {
+        size_t offset;
+        size_t size;
+    };
+
+    // 记录头：校验和、数据长度
+    static constexpr size_t HEADER = 2 * sizeof(uint64_t);
+
+    MappedFile file;
+    std::unordered_map<K, Location> index;
+
+    // 日志末尾（下一条记录的写入位置）
+    size_t tail;
+    size_t live_bytes;
+
+    size_t compactions;
+    size_t dropped;
+
+    // 压缩日志，使末尾至少能再放下 need 字节
+    void Compact(size_t need);
+};
+
+#include "FileTier.tpp"
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// 构造函数实现
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+FileTier<K, V, KeySerializer, ValueSerializer>::FileTier(const std::string &path, size_t capacity)
+    : file(path, capacity), tail(0), live_bytes(0), compactions(0), dropped(0) {}
+
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+bool FileTier<K, V, KeySerializer, ValueSerializer>::Put(const K &key, const V &value,
+                                                        Clock::time_point write_deadline) {
+    // 1. 旧记录变为垃圾
+    auto old = index.find(key);
+    if (old != index.end()) {
+        live_bytes = live_bytes - old->second.size;
+        index.erase(old);
+    }
+
+    // 2. 先只统计序列化后的长度，确定日志末尾放得下再直接写入映射区，不经过中间缓冲
+    int64_t deadline = write_deadline.time_since_epoch().count();
+    SnapshotWriter measure(nullptr, 0);
+    Serializer<int64_t>::Write(measure, deadline);
+    KeySerializer::Write(measure, key);
+    ValueSerializer::Write(measure, value);
+
+    size_t payload = measure.Written();
+    size_t size = HEADER + payload;
+    if (!file.IsOpen() || size > file.Size())
+        return false;
+
+    // 3. 日志写满时先压缩
+    if (tail + size > file.Size())
+        Compact(size);
+
+    // 4. 追加到日志末尾并更新索引
+    SnapshotWriter writer(file.Data() + tail + HEADER, payload);
+    Serializer<int64_t>::Write(writer, deadline);
+    KeySerializer::Write(writer, key);
+    ValueSerializer::Write(writer, value);
+
+    uint64_t header[2] = {writer.Checksum(), payload};
+    std::memcpy(file.Data() + tail, header, HEADER);
+
+    index.emplace(key, Location{tail, size});
+    tail = tail + size;
+    live_bytes = live_bytes + size;
+    return true;
+}
+
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+std::optional<V> FileTier<K, V, KeySerializer, ValueSerializer>::Get(const K &key) const {
+    Clock::time_point write_deadline;
+    return Get(key, Clock::time_point::min(), write_deadline);
+}
+
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+std::optional<V> FileTier<K, V, KeySerializer, ValueSerializer>::Get(const K &key, Clock::time_point now,
+                                                                     Clock::time_point &write_deadline) const {
+    auto it = index.find(key);
+    if (it == index.end())
+        return std::nullopt;
+
+    const char *record = file.Data() + it->second.offset;
+    uint64_t header[2];
+    std::memcpy(header, record, HEADER);
+    if (HEADER + header[1] != it->second.size)
+        return std::nullopt;
+
+    SnapshotReader reader(record + HEADER, static_cast<size_t>(header[1]));
+
+    int64_t deadline = 0;
+    K stored{};
+    V value{};
+    if (!Serializer<int64_t>::Read(reader, deadline) || !KeySerializer::Read(reader, stored) ||
+        !ValueSerializer::Read(reader, value))
+        return std::nullopt;
+    if (reader.Checksum() != header[0] || !(stored == key))
+        return std::nullopt;
+
+    write_deadline = Clock::time_point(Clock::duration(deadline));
+    if (now >= write_deadline)
+        return std::nullopt;
+
+    return value;
+}
+
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+void FileTier<K, V, KeySerializer, ValueSerializer>::Compact(size_t need) {
+    compactions = compactions + 1;
+
+    // 1. 有效记录按在日志中的位置（即写入顺序）排序
+    using Iterator = typename std::unordered_map<K, Location>::iterator;
+    std::vector<Iterator> records;
+    records.reserve(index.size());
+    for (auto it = index.begin(); it != index.end(); ++it)
+        records.push_back(it);
+    std::sort(records.begin(), records.end(), [](const Iterator &a, const Iterator &b) {
+        return a->second.offset < b->second.offset;
+    });
+
+    // 2. 丢弃最早写入的记录，直到压缩后能空出 max(need, 容量的四分之一)，
+    //    避免日志刚压缩完又写满、每次写入都触发压缩
+    size_t reserve = std::max(need, file.Size() / 4);
+    size_t keep = file.Size() - reserve;
+    size_t first = 0;
+    while (live_bytes > keep) {
+        live_bytes = live_bytes - records[first]->second.size;
+        index.erase(records[first]);
+        dropped = dropped + 1;
+        first = first + 1;
+    }
+
+    // 3. 剩余记录依次前移，目标位置不会超过原位置，memmove 可以安全地原地移动
+    size_t write = 0;
+    for (size_t i = first; i < records.size(); ++i) {
+        Location &location = records[i]->second;
+        if (location.offset != write)
+            std::memmove(file.Data() + write, file.Data() + location.offset, location.size);
+        location.offset = write;
+        write = write + location.size;
+    }
+
+    tail = write;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/*
+ * 映射到内存的定长文件（POSIX mmap）：
+ * 1. 打开时截断并预先分配全部磁盘空间，之后写入映射区不会因为磁盘满而触发 SIGBUS
+ * 2. 映射区可读可写，修改由内核在后台写回文件，不需要显式的 write 调用
+ * 3. 访问模式提示为随机访问，内核不做无用的预读
+ *
+ */
+
+class MappedFile {
+public:
+    MappedFile(const std::string &path, size_t size);
+
+    // 禁用拷贝：析构时解除映射
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ~MappedFile();
+
+    bool IsOpen() const { return data != nullptr; }
+
+    char *Data() const { return data; }
+
+    size_t Size() const { return size; }
+
+private:
+    int fd;
+    char *data;
+    size_t size;
+};
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include "FileTier.hpp"
+#include "../LRU/LRUCache.hpp"
+#include "../Queue/BoundedMPMCQueue.hpp"
+
+/*
+ * 两层缓存配置：
+ * path / file_capacity 为文件层的路径与大小（字节），write_queue 为等待写入文件层的条目上限；
+ * memory 为内存层（LRUCache）的其余配置，其中的 on_evict 仍会被调用；
+ * bulk_source 不使用（两层缓存不提供批量查找）
+ */
+template<typename K, typename V>
+struct TieredCacheOptions {
+    std::string path;
+    size_t file_capacity = 64 * 1024 * 1024;
+    size_t write_queue = 1024;
+
+    LRUCacheOptions<K, V> memory;
+};
+
+/*
+ * 两层缓存：内存中的 LRUCache 在前，本地文件层（见 FileTier.hpp）在后，适合工作集远大于内存、
+ * 但本地磁盘远快于数据源的场景：
+ * 1. 内存层淘汰的条目经 on_evict 放入有界无锁队列，由后台线程批量写入文件层，查找线程不等待磁盘；
+ *    队列满时新淘汰的条目直接丢弃（只是少缓存一个条目）
+ * 2. 内存层未命中时先查文件层，命中则放回内存层，否则才调用数据源；
+ *    刚被淘汰、还在队列中等待写入的条目查不到，会重新从数据源加载
+ * 3. 析构时先把队列中剩余的条目写完
+ * 4. 过期：条目的写入期限（expire_after_write 或 expiry）随条目写入文件层，文件层中过期的记录当作未命中；
+ *    从文件层放回内存层的条目沿用原来的写入期限，不会因为经过文件层而续期。
+ *    淘汰时已经过期的条目不写入文件层；expire_after_access 只作用于内存层
+ *
+ * 与 LRUCache 一样，查找不是线程安全的；文件层由查找线程与后台线程共享，用一把锁保护
+ */
+template<typename K, typename V, typename KeySerializer = Serializer<K>, typename ValueSerializer = Serializer<V>>
+class TieredCache {
+public:
+    TieredCache(size_t max_sz, std::function<V(const K &)> source, TieredCacheOptions<K, V> options);
+
+    // 禁用拷贝：后台线程持有 this 指针
+    TieredCache(const TieredCache &) = delete;
+
+    TieredCache &operator=(const TieredCache &) = delete;
+
+    ~TieredCache();
+
+    // 缓存查找函数
+    V CacheLookup(const K &key);
+
+    // 等待已淘汰的条目全部写入文件层
+    void Flush();
+
+    // 文件层是否可用；不可用时退化为单层的 LRUCache
+    bool FileTierOpen() const { return file.IsOpen(); }
+
+    // 内存层的条目数
+    size_t Size() const { return memory.Size(); }
+
+    // 文件层的条目数
+    size_t FileSize() const;
+
+    // 内存层未命中后，文件层命中、未命中的次数
+    size_t FileHits() const { return file_hits; }
+
+    size_t FileMisses() const { return file_misses; }
+
+    // 因写入队列已满而丢弃的淘汰条目数
+    size_t DroppedWrites() const { return dropped_writes; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // 内存层中的值连同它的写入期限（永不过期时为 time_point::max()）
+    struct Stamped {
+        V value;
+        Clock::time_point write_deadline = Clock::time_point::max();
+    };
+
+    using Pending = std::pair<K, Stamped>;
+
+    // 后台线程一次最多写入的条目数
+    static constexpr size_t WRITE_BATCH = 64;
+
+    std::function<V(const K &)> data_source;
+
+    // 用户为内存层设置的配置，淘汰回调、权重与过期时间由内存层的适配版本转调
+    LRUCacheOptions<K, V> user_options;
+
+    mutable std::mutex file_mtx;
+    FileTier<K, V, KeySerializer, ValueSerializer> file;
+
+    BoundedMPMCQueue<Pending> queue;
+
+    // 已放入队列、尚未写入文件层的条目数，后台线程与 Flush 在其上等待
+    std::atomic<size_t> pending;
+    std::atomic<bool> stopping;
+
+    size_t file_hits;
+    size_t file_misses;
+    size_t dropped_writes;
+
+    // 内存层的回调使用以上成员，因此在它们之后构造
+    LRUCache<K, Stamped> memory;
+
+    std::thread writer;
+
+    // 内存层的数据源：先查文件层（带回原来的写入期限），再调用数据源
+    Stamped LoadBelow(const K &key);
+
+    void OnEvict(const K &key, const Stamped &stamped);
+
+    void WriterLoop();
+
+    // 是否设置了写入期限
+    bool ExpiresAfterWrite() const;
+
+    // 把用户的内存层配置适配到 Stamped 值上
+    LRUCacheOptions<K, Stamped> MemoryOptions();
+};
+
+#include "TieredCache.tpp"
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+// 构造函数实现
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+TieredCache<K, V, KeySerializer, ValueSerializer>::TieredCache(size_t max_sz, std::function<V(const K &)> source,
+                                                              TieredCacheOptions<K, V> options)
+    : data_source(std::move(source)), user_options(std::move(options.memory)),
+      file(options.path, options.file_capacity), queue(options.write_queue), pending(0), stopping(false),
+      file_hits(0), file_misses(0), dropped_writes(0),
+      memory(max_sz, [this](const K &key) { return LoadBelow(key); }, MemoryOptions()),
+      writer([this]() { WriterLoop(); }) {}
+
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+TieredCache<K, V, KeySerializer, ValueSerializer>::~TieredCache() {
+    // 计数变为非零以唤醒后台线程，它写完队列中剩余的条目后退出
+    stopping.store(true);
+    pending.fetch_add(1);
+    pending.notify_all();
+    writer.join();
+}
+
+// 缓存查找函数实现
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+V TieredCache<K, V, KeySerializer, ValueSerializer>::CacheLookup(const K &key) {
+    return memory.CacheLookup(key).value;
+}
+
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+void TieredCache<K, V, KeySerializer, ValueSerializer>::Flush() {
+    size_t remaining = pending.load();
+    while (remaining != 0) {
+        pending.wait(remaining);
+        remaining = pending.load();
+    }
+}
+
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+size_t TieredCache<K, V, KeySerializer, ValueSerializer>::FileSize() const {
+    std::lock_guard lock(file_mtx);
+    return file.Size();
+}
+
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+typename TieredCache<K, V, KeySerializer, ValueSerializer>::Stamped
+TieredCache<K, V, KeySerializer, ValueSerializer>::LoadBelow(const K &key) {
+    Clock::time_point now = user_options.now();
+
+    Stamped stamped;
+    std::optional<V> value;
+    {
+        std::lock_guard lock(file_mtx);
+        value = file.Get(key, now, stamped.write_deadline);
+    }
+
+    if (value.has_value()) {
+        file_hits = file_hits + 1;
+        stamped.value = std::move(value.value());
+        return stamped;
+    }
+
+    file_misses = file_misses + 1;
+    stamped.value = data_source(key);
+    stamped.write_deadline = Clock::time_point::max();
+
+    // 写入期限从加载时算起，与 LRUCache 的计算方式相同
+    if (ExpiresAfterWrite()) {
+        Clock::duration ttl = user_options.expiry ? user_options.expiry(key, stamped.value)
+                                                  : user_options.expire_after_write;
+        if (ttl < Clock::time_point::max() - now)
+            stamped.write_deadline = now + ttl;
+    }
+    return stamped;
+}
+
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+void TieredCache<K, V, KeySerializer, ValueSerializer>::OnEvict(const K &key, const Stamped &stamped) {
+    if (user_options.on_evict)
+        user_options.on_evict(key, stamped.value);
+
+    if (!file.IsOpen())
+        return;
+
+    // 先计数再入队：后台线程看到的计数不会少于队列中的条目数
+    pending.fetch_add(1);
+    if (!queue.TryEnqueue(Pending(key, stamped))) {
+        pending.fetch_sub(1);
+        pending.notify_all();
+        dropped_writes = dropped_writes + 1;
+        return;
+    }
+    pending.notify_one();
+}
+
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+void TieredCache<K, V, KeySerializer, ValueSerializer>::WriterLoop() {
+    std::vector<Pending> batch(WRITE_BATCH);
+
+    while (true) {
+        size_t count = queue.TryDequeueBatch(batch);
+        if (count == 0) {
+            if (stopping.load())
+                return;
+
+            // 计数为零时睡眠，有新条目入队时被唤醒
+            pending.wait(0);
+            continue;
+        }
+
+        // 每次写入单独加锁：Put 可能触发压缩，整批持锁会让落到文件层的未命中等待整批写完
+        for (size_t i = 0; i < count; ++i) {
+            std::lock_guard lock(file_mtx);
+            file.Put(batch[i].first, batch[i].second.value, batch[i].second.write_deadline);
+        }
+
+        pending.fetch_sub(count);
+        pending.notify_all();
+    }
+}
+
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+bool TieredCache<K, V, KeySerializer, ValueSerializer>::ExpiresAfterWrite() const {
+    return user_options.expiry || user_options.expire_after_write != Clock::duration::max();
+}
+
+template<typename K, typename V, typename KeySerializer, typename ValueSerializer>
+LRUCacheOptions<K, typename TieredCache<K, V, KeySerializer, ValueSerializer>::Stamped>
+TieredCache<K, V, KeySerializer, ValueSerializer>::MemoryOptions() {
+    LRUCacheOptions<K, Stamped> memory;
+    memory.expire_after_access = user_options.expire_after_access;
+    memory.timer_tick = user_options.timer_tick;
+    memory.now = user_options.now;
+
+    if (user_options.weigher) {
+        memory.weigher = [this](const K &key, const Stamped &stamped) {
+            return user_options.weigher(key, stamped.value);
+        };
+    }
+
+    // 写入期限已经算在值里，内存层按剩余时间计时；未设置写入期限时不设置 expiry，内存层不为此创建时间轮
+    if (ExpiresAfterWrite()) {
+        memory.expiry = [this](const K &, const Stamped &stamped) -> Clock::duration {
+            if (stamped.write_deadline == Clock::time_point::max())
+                return Clock::duration::max();
+
+            Clock::time_point now = user_options.now();
+            return stamped.write_deadline > now ? stamped.write_deadline - now : Clock::duration::zero();
+        };
+    }
+
+    memory.on_evict = [this](const K &key, const Stamped &stamped) { OnEvict(key, stamped); };
+    return memory;
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+/*
+ * 分层时间轮（Hierarchical Timing Wheel）：
+ * 1. 时间被划分为固定长度的刻度（tick），共 4 层，每层 64 个槽
+ * 2. 第 0 层每个槽对应 1 个刻度，第 l 层每个槽对应 64^l 个刻度，
+ *    定时器按到期时间与当前时间的距离放入对应层的槽中
+ * 3. 时间前进到高层槽的边界时，把该槽中的定时器重新分配（级联）到更低的层
+ * 4. 插入、取消都是 O(1)，推进时每个定时器最多级联 4 次，均摊 O(1)
+ * 5. 超出 64^4 个刻度的定时器先放在最高层最远的槽中，到达时再重新分配
+ * 6. 每层用一个 64 位的位图记录哪些槽非空，推进时直接跳到下一个有事可做的刻度
+ *    （第 0 层非空槽的刻度，或高层非空槽的级联边界），长时间空闲后的推进不逐个刻度地走
+ *
+ */
+
+template<typename K>
+struct TimerNode {
+    using Clock = std::chrono::steady_clock;
+
+    K key;
+
+    // 实际到期时间；按写入时间计算的到期上限（访问后过期的条目不会超过它）
+    Clock::time_point expires_at;
+    Clock::time_point write_deadline;
+
+    // 按刻度计的到期时间
+    uint64_t deadline;
+
+    // 槽内的双向链表；pprev 指向前驱的 next 字段（或槽头），为 nullptr 表示不在时间轮中
+    TimerNode *next;
+    TimerNode **pprev;
+
+    explicit TimerNode(const K &k)
+        : key(k), expires_at(), write_deadline(), deadline(0), next(nullptr), pprev(nullptr) {
+    }
+};
+
+template<typename K>
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    TimerWheel(Clock::duration tick, Clock::time_point start);
+
+    // 禁用拷贝：槽中保存的是外部节点的指针
+    TimerWheel(const TimerWheel &) = delete;
+
+    TimerWheel &operator=(const TimerWheel &) = delete;
+
+    // 按 node->expires_at 放入时间轮；节点已在时间轮中时先取出（即重新调度）
+    void Schedule(TimerNode<K> *node);
+
+    // 从时间轮中取出节点，不释放内存
+    void Cancel(TimerNode<K> *node);
+
+    // 推进到 now，对每个到期的节点调用 on_expire(node)；回调时节点已不在时间轮中
+    template<typename F>
+    void Advance(Clock::time_point now, F on_expire);
+
+    size_t Size() const { return count; }
+
+private:
+    static constexpr int LEVELS = 4;
+    static constexpr int SLOT_BITS = 6;
+    static constexpr uint64_t SLOTS = uint64_t{1} << SLOT_BITS;
+    static constexpr uint64_t SLOT_MASK = SLOTS - 1;
+
+    TimerNode<K> *slots[LEVELS][SLOTS];
+
+    // 第 l 层的第 s 位为 1 表示 slots[l][s] 非空
+    uint64_t occupied[LEVELS];
+
+    Clock::duration tick;
+    Clock::time_point start;
+
+    // 已处理到的刻度
+    uint64_t current;
+    size_t count;
+
+    uint64_t ToTicks(Clock::time_point time, bool round_up) const;
+
+    // 按到期刻度放入对应层的槽，早于 earliest 的按 earliest 处理
+    void Place(TimerNode<K> *node, uint64_t earliest);
+
+    void Link(TimerNode<K> *&head, TimerNode<K> *node);
+
+    void Unlink(TimerNode<K> *node);
+
+    // 把第 level 层的一个槽中的节点重新分配到更低的层
+    void Cascade(int level, uint64_t slot);
+
+    // current 之后第一个需要处理的刻度：第 0 层非空槽的刻度或高层非空槽的级联边界；时间轮为空时为 UINT64_MAX
+    uint64_t NextEvent() const;
+};
+
+#include "TimerWheel.tpp"
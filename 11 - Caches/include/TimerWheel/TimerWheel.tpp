@@ -0,0 +1,176 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+
+// 构造函数实现
+template<typename K>
+TimerWheel<K>::TimerWheel(Clock::duration tick, Clock::time_point start)
+    : slots(), occupied(), tick(tick.count() > 0 ? tick : Clock::duration(1)), start(start), current(0), count(0) {
+}
+
+template<typename K>
+void TimerWheel<K>::Schedule(TimerNode<K> *node) {
+    if (node->pprev != nullptr)
+        Cancel(node);
+
+    // 当前刻度已经处理过，最早只能在下一个刻度触发
+    node->deadline = ToTicks(node->expires_at, true);
+    Place(node, current + 1);
+    count = count + 1;
+}
+
+template<typename K>
+void TimerWheel<K>::Cancel(TimerNode<K> *node) {
+    if (node->pprev == nullptr)
+        return;
+
+    Unlink(node);
+    count = count - 1;
+}
+
+template<typename K>
+template<typename F>
+void TimerWheel<K>::Advance(Clock::time_point now, F on_expire) {
+    uint64_t target = ToTicks(now, false);
+
+    while (current < target) {
+        // 时间轮为空时直接跳到目标刻度
+        if (count == 0) {
+            current = target;
+            return;
+        }
+
+        // 跳过没有任何槽需要处理的刻度：这些刻度上的级联与第 0 层处理都是空操作
+        uint64_t next = NextEvent();
+        if (next > target) {
+            current = target;
+            return;
+        }
+        current = next;
+
+        // 从高层到低层级联：高层的节点可能落入本刻度需要级联的低层槽
+        for (int level = LEVELS - 1; level >= 1; --level) {
+            uint64_t span_mask = (uint64_t{1} << (SLOT_BITS * level)) - 1;
+            if ((current & span_mask) == 0)
+                Cascade(level, (current >> (SLOT_BITS * level)) & SLOT_MASK);
+        }
+
+        // 处理第 0 层当前槽：先整体摘下，再逐个回调，回调中可以安全地操作时间轮
+        TimerNode<K> *node = slots[0][current & SLOT_MASK];
+        slots[0][current & SLOT_MASK] = nullptr;
+        occupied[0] = occupied[0] & ~(uint64_t{1} << (current & SLOT_MASK));
+
+        while (node != nullptr) {
+            TimerNode<K> *next = node->next;
+            node->next = nullptr;
+            node->pprev = nullptr;
+
+            if (node->deadline <= current) {
+                count = count - 1;
+                on_expire(node);
+            } else {
+                Place(node, current + 1);
+            }
+            node = next;
+        }
+    }
+}
+
+template<typename K>
+uint64_t TimerWheel<K>::ToTicks(Clock::time_point time, bool round_up) const {
+    if (time <= start)
+        return 0;
+
+    auto elapsed = time - start;
+    auto ticks = static_cast<uint64_t>(elapsed / tick);
+    if (round_up && elapsed % tick != Clock::duration::zero())
+        ticks = ticks + 1;
+
+    return ticks;
+}
+
+template<typename K>
+void TimerWheel<K>::Place(TimerNode<K> *node, uint64_t earliest) {
+    uint64_t deadline = node->deadline > earliest ? node->deadline : earliest;
+    uint64_t delta = deadline - current;
+
+    for (int level = 0; level < LEVELS; ++level) {
+        if (delta < (uint64_t{1} << (SLOT_BITS * (level + 1)))) {
+            Link(slots[level][(deadline >> (SLOT_BITS * level)) & SLOT_MASK], node);
+            return;
+        }
+    }
+
+    // 超出时间轮范围：放在最高层最远的槽，到达时重新分配
+    int top = LEVELS - 1;
+    Link(slots[top][((current >> (SLOT_BITS * top)) - 1) & SLOT_MASK], node);
+}
+
+template<typename K>
+void TimerWheel<K>::Link(TimerNode<K> *&head, TimerNode<K> *node) {
+    size_t index = &head - &slots[0][0];
+    occupied[index / SLOTS] = occupied[index / SLOTS] | (uint64_t{1} << (index % SLOTS));
+
+    node->next = head;
+    node->pprev = &head;
+    if (head != nullptr)
+        head->pprev = &node->next;
+    head = node;
+}
+
+template<typename K>
+void TimerWheel<K>::Unlink(TimerNode<K> *node) {
+    *node->pprev = node->next;
+    if (node->next != nullptr)
+        node->next->pprev = node->pprev;
+
+    // pprev 指向槽头且槽已空时清除占用位；指向前驱节点的 next 字段时槽中还有前驱
+    TimerNode<K> **first = &slots[0][0];
+    std::less<TimerNode<K> **> before;
+    if (*node->pprev == nullptr && !before(node->pprev, first) && before(node->pprev, first + LEVELS * SLOTS)) {
+        size_t index = node->pprev - first;
+        occupied[index / SLOTS] = occupied[index / SLOTS] & ~(uint64_t{1} << (index % SLOTS));
+    }
+
+    node->next = nullptr;
+    node->pprev = nullptr;
+}
+
+template<typename K>
+void TimerWheel<K>::Cascade(int level, uint64_t slot) {
+    TimerNode<K> *node = slots[level][slot];
+    slots[level][slot] = nullptr;
+    occupied[level] = occupied[level] & ~(uint64_t{1} << slot);
+
+    while (node != nullptr) {
+        TimerNode<K> *next = node->next;
+        node->next = nullptr;
+        node->pprev = nullptr;
+
+        // 级联发生在处理第 0 层当前槽之前，恰好在本刻度到期的节点仍能按时触发
+        Place(node, current);
+        node = next;
+    }
+}
+
+template<typename K>
+uint64_t TimerWheel<K>::NextEvent() const {
+    uint64_t next = UINT64_MAX;
+
+    for (int level = 0; level < LEVELS; ++level) {
+        if (occupied[level] == 0)
+            continue;
+
+        // 第 level 层的槽在编号 b 的边界（刻度 b * 64^level）处理，槽号为 b 的低 6 位；
+        // 把位图循环右移到下一个边界的槽号，最低的 1 位即还要经过几个边界
+        int shift = SLOT_BITS * level;
+        uint64_t boundary = (current >> shift) + 1;
+        uint64_t rotated = std::rotr(occupied[level], static_cast<int>(boundary & SLOT_MASK));
+        uint64_t event = (boundary + static_cast<uint64_t>(std::countr_zero(rotated))) << shift;
+        next = std::min(next, event);
+    }
+
+    return next;
+}
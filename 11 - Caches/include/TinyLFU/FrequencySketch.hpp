@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/*
+ * TinyLFU 的访问频率估计器：
+ * 1. 计数最小草图（Count-Min Sketch）：4 个哈希函数，每个计数器只占 4 位，
+ *    一个 uint64_t 存放 16 个计数器，估计值取 4 个计数器中的最小值
+ * 2. 门卫（Doorkeeper）布隆过滤器：键第一次出现只记在门卫中，第二次起才进入草图，
+ *    大量只出现一次的键不会污染计数器
+ * 3. 老化：累计记录次数达到采样上限后，所有计数器减半并清空门卫，
+ *    让过去的热点逐渐冷却
+ * 内存只与容量有关，与缓存条目数量无关
+ *
+ */
+
+template<typename K>
+class FrequencySketch {
+private:
+    // 4 位计数器表，长度为 2 的幂
+    std::vector<uint64_t> table;
+    size_t table_mask;
+
+    // 门卫布隆过滤器，位数为 2 的幂
+    std::vector<uint64_t> doorkeeper;
+    size_t doorkeeper_mask;
+
+    // 老化周期：记录次数达到 sample_size 时计数器减半
+    size_t additions;
+    size_t sample_size;
+
+    static uint64_t Mix(uint64_t x);
+
+    // 第 i 个哈希函数选中的计数器下标（以 4 位计数器为单位）
+    size_t CounterIndex(uint64_t hash, int i) const;
+
+    size_t CounterValue(size_t index) const;
+
+    bool DoorkeeperContains(uint64_t hash) const;
+
+    // 返回键之前是否已经在门卫中
+    bool DoorkeeperInsert(uint64_t hash);
+
+    void Reset();
+
+public:
+    // capacity 为缓存容量，草图大小与采样周期都按它确定
+    explicit FrequencySketch(size_t capacity);
+
+    // 记录一次访问
+    void Increment(const K &key);
+
+    // 估计访问频率，最大值为 15 + 1（门卫）
+    size_t Frequency(const K &key) const;
+};
+
+#include "FrequencySketch.tpp"
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+
+// 构造函数实现
+template<typename K>
+FrequencySketch<K>::FrequencySketch(size_t capacity)
+    : table_mask(0), doorkeeper_mask(0), additions(0) {
+    size_t counters = 16;
+    while (counters < capacity * 4)
+        counters = counters * 2;
+
+    // 16 个计数器一组
+    table.assign(counters / 16, 0);
+    table_mask = counters - 1;
+
+    // 门卫每个键约 8 位
+    size_t bits = 64;
+    while (bits < capacity * 8)
+        bits = bits * 2;
+    doorkeeper.assign(bits / 64, 0);
+    doorkeeper_mask = bits - 1;
+
+    sample_size = std::max<size_t>(capacity, 1) * 10;
+}
+
+template<typename K>
+void FrequencySketch<K>::Increment(const K &key) {
+    uint64_t hash = Mix(std::hash<K>{}(key));
+
+    // 第一次出现只记录在门卫中
+    if (DoorkeeperInsert(hash)) {
+        // 保守更新：只增加等于最小值的计数器，减小高估
+        size_t indices[4];
+        size_t minimum = 15;
+        for (int i = 0; i < 4; ++i) {
+            indices[i] = CounterIndex(hash, i);
+            minimum = std::min(minimum, CounterValue(indices[i]));
+        }
+
+        if (minimum < 15) {
+            for (size_t index: indices) {
+                if (CounterValue(index) == minimum)
+                    table[index >> 4] = table[index >> 4] + (uint64_t{1} << ((index & 15) * 4));
+            }
+        }
+    }
+
+    additions = additions + 1;
+    if (additions >= sample_size)
+        Reset();
+}
+
+template<typename K>
+size_t FrequencySketch<K>::Frequency(const K &key) const {
+    uint64_t hash = Mix(std::hash<K>{}(key));
+
+    size_t minimum = 15;
+    for (int i = 0; i < 4; ++i)
+        minimum = std::min(minimum, CounterValue(CounterIndex(hash, i)));
+
+    return DoorkeeperContains(hash) ? minimum + 1 : minimum;
+}
+
+template<typename K>
+uint64_t FrequencySketch<K>::Mix(uint64_t x) {
+    // SplitMix64 终结函数：std::hash 对整数通常是恒等映射，需要先打散
+    x = x + 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+template<typename K>
+size_t FrequencySketch<K>::CounterIndex(uint64_t hash, int i) const {
+    // 4 个哈希函数使用的种子
+    static constexpr uint64_t seeds[4] = {
+        0xC3A5C85C97CB3127ULL, 0xB492B66FBE98F273ULL, 0x9AE16A3B2F90404FULL, 0xCBF29CE484222325ULL
+    };
+
+    uint64_t h = (hash ^ seeds[i]) * seeds[(i + 1) & 3];
+    return static_cast<size_t>(h >> 32) & table_mask;
+}
+
+template<typename K>
+size_t FrequencySketch<K>::CounterValue(size_t index) const {
+    return static_cast<size_t>((table[index >> 4] >> ((index & 15) * 4)) & 0xF);
+}
+
+template<typename K>
+bool FrequencySketch<K>::DoorkeeperContains(uint64_t hash) const {
+    // 两个哈希函数分别取哈希值的低 32 位和高 32 位
+    size_t bit1 = static_cast<size_t>(hash) & doorkeeper_mask;
+    size_t bit2 = static_cast<size_t>(hash >> 32) & doorkeeper_mask;
+    return (doorkeeper[bit1 >> 6] >> (bit1 & 63) & 1) != 0 &&
+           (doorkeeper[bit2 >> 6] >> (bit2 & 63) & 1) != 0;
+}
+
+template<typename K>
+bool FrequencySketch<K>::DoorkeeperInsert(uint64_t hash) {
+    bool present = DoorkeeperContains(hash);
+
+    size_t bit1 = static_cast<size_t>(hash) & doorkeeper_mask;
+    size_t bit2 = static_cast<size_t>(hash >> 32) & doorkeeper_mask;
+    doorkeeper[bit1 >> 6] = doorkeeper[bit1 >> 6] | (uint64_t{1} << (bit1 & 63));
+    doorkeeper[bit2 >> 6] = doorkeeper[bit2 >> 6] | (uint64_t{1} << (bit2 & 63));
+
+    return present;
+}
+
+template<typename K>
+void FrequencySketch<K>::Reset() {
+    // 每个 4 位计数器右移一位即减半，从相邻计数器移入的最高位由掩码清除
+    for (auto &word: table)
+        word = (word >> 1) & 0x7777777777777777ULL;
+
+    std::fill(doorkeeper.begin(), doorkeeper.end(), 0);
+    additions = additions / 2;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include "FrequencySketch.hpp"
+
+/*
+ * W-TinyLFU 缓存（参考 Caffeine 的设计）：
+ * 1. 窗口区：约占容量 1% 的小 LRU，新条目先进入这里，吸收突发的新热点
+ * 2. 主区：分段 LRU（SLRU），由试用段（probation）和保护段（protected，约占主区 80%）组成；
+ *    试用段中再次被访问的条目晋升到保护段，保护段溢出的条目降级回试用段
+ * 3. 准入：窗口区淘汰出的候选者要进入主区时，与主区的受害者（试用段最久未使用者）比较
+ *    估计频率，只有候选者频率更高才替换受害者，否则候选者被丢弃
+ * 一次性的大范围扫描中的键频率很低，无法挤掉主区中的热点数据
+ *
+ */
+
+enum class TinyLFURegion {
+    Window,
+    Probation,
+    Protected
+};
+
+template<typename K, typename V>
+struct TinyLFUEntry {
+    V value;
+    TinyLFURegion region;
+    typename std::list<K>::iterator position;
+};
+
+template<typename K, typename V>
+class TinyLFUCache {
+private:
+    std::unordered_map<K, TinyLFUEntry<K, V>> ht;
+
+    // 三个 LRU 链表，front 端最久未使用
+    std::list<K> window;
+    std::list<K> probation;
+    std::list<K> protected_segment;
+
+    size_t max_size;
+    size_t window_size;
+    size_t protected_size;
+
+    FrequencySketch<K> sketch;
+
+    // 慢速数据源
+    std::function<V(const K &)> data_source;
+
+    std::list<K> &ListOf(TinyLFURegion region);
+
+    // 把条目移到 region 对应链表的尾部；链表之间用 splice 转移，不分配内存
+    void MoveTo(TinyLFUEntry<K, V> &entry, TinyLFURegion region);
+
+    void OnHit(TinyLFUEntry<K, V> &entry);
+
+    // 窗口区超出容量时，把最久未使用者交给准入过滤器
+    void EvictFromWindow();
+
+    // 保护段超出容量时，把最久未使用者降级到试用段
+    void DemoteFromProtected();
+
+public:
+    // 构造函数
+    TinyLFUCache(size_t max_sz, std::function<V(const K &)> source);
+
+    // 缓存查找函数
+    V CacheLookup(const K &key);
+
+    // 判断键是否在缓存中，不记录访问
+    bool Contains(const K &key) const;
+
+    size_t Size() const { return ht.size(); }
+};
+
+#include "TinyLFUCache.tpp"
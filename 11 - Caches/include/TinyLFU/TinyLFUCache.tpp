@@ -0,0 +1,124 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+
+// 构造函数实现
+template<typename K, typename V>
+TinyLFUCache<K, V>::TinyLFUCache(size_t max_sz, std::function<V(const K &)> source)
+    : max_size(max_sz), sketch(max_sz), data_source(std::move(source)) {
+    // 窗口区至少 1 个条目，主区中保护段占 80%
+    window_size = max_size == 0 ? 0 : std::max<size_t>(1, max_size / 100);
+    protected_size = (max_size - window_size) * 4 / 5;
+    ht.reserve(max_size);
+}
+
+// 缓存查找函数实现
+template<typename K, typename V>
+V TinyLFUCache<K, V>::CacheLookup(const K &key) {
+    // 无论命中与否都记录访问频率
+    sketch.Increment(key);
+
+    auto it = ht.find(key);
+    if (it != ht.end()) {
+        OnHit(it->second);
+        return it->second.value;
+    }
+
+    V data = data_source(key);
+    if (max_size == 0)
+        return data;
+
+    // 新条目先进入窗口区
+    window.push_back(key);
+    ht.emplace(key, TinyLFUEntry<K, V>{data, TinyLFURegion::Window, std::prev(window.end())});
+
+    if (window.size() > window_size)
+        EvictFromWindow();
+
+    return data;
+}
+
+template<typename K, typename V>
+bool TinyLFUCache<K, V>::Contains(const K &key) const {
+    return ht.find(key) != ht.end();
+}
+
+template<typename K, typename V>
+std::list<K> &TinyLFUCache<K, V>::ListOf(TinyLFURegion region) {
+    switch (region) {
+        case TinyLFURegion::Window:
+            return window;
+        case TinyLFURegion::Probation:
+            return probation;
+        default:
+            return protected_segment;
+    }
+}
+
+template<typename K, typename V>
+void TinyLFUCache<K, V>::MoveTo(TinyLFUEntry<K, V> &entry, TinyLFURegion region) {
+    std::list<K> &target = ListOf(region);
+    target.splice(target.end(), ListOf(entry.region), entry.position);
+    entry.region = region;
+}
+
+template<typename K, typename V>
+void TinyLFUCache<K, V>::OnHit(TinyLFUEntry<K, V> &entry) {
+    switch (entry.region) {
+        case TinyLFURegion::Window:
+            MoveTo(entry, TinyLFURegion::Window);
+            break;
+        case TinyLFURegion::Probation:
+            // 试用段中再次被访问，晋升到保护段
+            MoveTo(entry, TinyLFURegion::Protected);
+            if (protected_segment.size() > protected_size)
+                DemoteFromProtected();
+            break;
+        case TinyLFURegion::Protected:
+            MoveTo(entry, TinyLFURegion::Protected);
+            break;
+    }
+}
+
+template<typename K, typename V>
+void TinyLFUCache<K, V>::EvictFromWindow() {
+    const K &candidate = window.front();
+    auto &candidate_entry = ht.find(candidate)->second;
+
+    // 主区尚未填满：候选者直接进入试用段
+    if (probation.size() + protected_segment.size() < max_size - window_size) {
+        MoveTo(candidate_entry, TinyLFURegion::Probation);
+        return;
+    }
+
+    // 主区已满：受害者优先取试用段的最久未使用者
+    std::list<K> &victims = probation.empty() ? protected_segment : probation;
+    if (victims.empty()) {
+        // 主区容量为 0，候选者只能被淘汰
+        K evicted = candidate;
+        window.pop_front();
+        ht.erase(evicted);
+        return;
+    }
+
+    const K &victim = victims.front();
+    if (sketch.Frequency(candidate) > sketch.Frequency(victim)) {
+        // 候选者更热：淘汰受害者，候选者进入试用段
+        K evicted = victim;
+        victims.pop_front();
+        ht.erase(evicted);
+        MoveTo(candidate_entry, TinyLFURegion::Probation);
+    } else {
+        // 候选者不够热：直接丢弃候选者
+        K evicted = candidate;
+        window.pop_front();
+        ht.erase(evicted);
+    }
+}
+
+template<typename K, typename V>
+void TinyLFUCache<K, V>::DemoteFromProtected() {
+    auto &entry = ht.find(protected_segment.front())->second;
+    MoveTo(entry, TinyLFURegion::Probation);
+}
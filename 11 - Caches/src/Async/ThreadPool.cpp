@@ -0,0 +1,47 @@
+#include "Async/ThreadPool.hpp"
+
+ThreadPool::ThreadPool(size_t num_threads) : stopping(false) {
+    if (num_threads == 0)
+        num_threads = 1;
+
+    workers.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i)
+        workers.emplace_back([this]() { WorkerLoop(); });
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard lock(mtx);
+        stopping = true;
+    }
+    cv.notify_all();
+
+    for (auto &worker: workers)
+        worker.join();
+}
+
+void ThreadPool::Submit(std::function<void()> task) {
+    {
+        std::lock_guard lock(mtx);
+        tasks.push_back(std::move(task));
+    }
+    cv.notify_one();
+}
+
+void ThreadPool::WorkerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock lock(mtx);
+            cv.wait(lock, [this]() { return stopping || !tasks.empty(); });
+
+            // 停止时仍要把队列中的任务执行完
+            if (tasks.empty())
+                return;
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
@@ -0,0 +1,107 @@
+#include "Simulator/MissRatioCurve.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+    // 采样时哈希值取模的基数 P：键被采样当且仅当 hash mod P < rate * P
+    constexpr uint64_t SAMPLING_MODULUS = uint64_t{1} << 24;
+
+    constexpr size_t INITIAL_TREE_SIZE = size_t{1} << 16;
+}
+
+MissRatioCurve::MissRatioCurve(double sampling_rate)
+    : rate(sampling_rate > 0.0 && sampling_rate < 1.0 ? sampling_rate : 1.0),
+      threshold(static_cast<uint64_t>(rate * SAMPLING_MODULUS)), accesses(0), sampled(0), cold_misses(0),
+      tree(INITIAL_TREE_SIZE + 1, 0), clock(0) {
+}
+
+void MissRatioCurve::Access(uint64_t key) {
+    accesses = accesses + 1;
+    if (rate < 1.0 && (Mix(key) & (SAMPLING_MODULUS - 1)) >= threshold)
+        return;
+
+    sampled = sampled + 1;
+    if (clock + 1 >= tree.size())
+        Compact();
+    clock = clock + 1;
+
+    auto it = last_access.find(key);
+    if (it == last_access.end()) {
+        cold_misses = cold_misses + 1;
+        last_access.emplace(key, clock);
+    } else {
+        // 上一次访问之后仍然有效的时间点个数，即其间访问过的不同键的个数
+        auto distance = static_cast<size_t>(static_cast<int64_t>(last_access.size()) - Prefix(it->second));
+        if (distance >= distances.size())
+            distances.resize(distance + 1, 0);
+        distances[distance] = distances[distance] + 1;
+
+        Add(it->second, -1);
+        it->second = clock;
+    }
+
+    Add(clock, 1);
+}
+
+double MissRatioCurve::MissRatio(size_t size) const {
+    if (sampled == 0)
+        return 0.0;
+
+    // SHARDS-adj：实际采样数与期望的差额计入栈距离为 0 的桶
+    double expected = static_cast<double>(accesses) * rate;
+    double adjust = expected - static_cast<double>(sampled);
+    if (size == 0)
+        return 1.0;
+
+    // 采样的栈距离 d 对应实际距离约 d / rate，命中条件 d / rate < size
+    double limit = static_cast<double>(size) * rate;
+    double hits = adjust;
+    for (size_t d = 0; d < distances.size() && static_cast<double>(d) < limit; ++d)
+        hits = hits + static_cast<double>(distances[d]);
+
+    double miss_ratio = (expected - hits) / expected;
+    return std::clamp(miss_ratio, 0.0, 1.0);
+}
+
+size_t MissRatioCurve::DistinctKeys() const {
+    return static_cast<size_t>(static_cast<double>(last_access.size()) / rate);
+}
+
+void MissRatioCurve::Add(uint64_t time, int64_t delta) {
+    for (size_t i = time; i < tree.size(); i += i & (~i + 1))
+        tree[i] = tree[i] + delta;
+}
+
+int64_t MissRatioCurve::Prefix(uint64_t time) const {
+    int64_t sum = 0;
+    for (size_t i = time; i > 0; i -= i & (~i + 1))
+        sum = sum + tree[i];
+    return sum;
+}
+
+void MissRatioCurve::Compact() {
+    std::vector<std::pair<uint64_t, uint64_t>> live;
+    live.reserve(last_access.size());
+    for (const auto &[key, time]: last_access)
+        live.emplace_back(time, key);
+    std::sort(live.begin(), live.end());
+
+    // 至少留出与有效时间点同样多的空位，压缩的代价均摊到之后的访问上
+    size_t size = std::max(tree.size() - 1, 2 * live.size() + 2);
+    tree.assign(size + 1, 0);
+
+    clock = 0;
+    for (const auto &[time, key]: live) {
+        clock = clock + 1;
+        last_access[key] = clock;
+        Add(clock, 1);
+    }
+}
+
+uint64_t MissRatioCurve::Mix(uint64_t key) {
+    // splitmix64 的终结函数，使相邻的键也能均匀采样
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+    return key ^ (key >> 31);
+}
@@ -0,0 +1,63 @@
+#include "Simulator/TraceReader.hpp"
+
+#include <charconv>
+
+namespace {
+    // 文件流使用的缓冲区大小
+    constexpr size_t BUFFER_SIZE = size_t{1} << 20;
+}
+
+TraceReader::TraceReader(const std::string &path, TraceFormat format)
+    : buffer(BUFFER_SIZE), format(format), count(0) {
+    // 缓冲区必须在打开文件之前设置
+    in.rdbuf()->pubsetbuf(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    in.open(path, std::ios::binary);
+}
+
+bool TraceReader::Next(uint64_t &key) {
+    bool ok = format == TraceFormat::Text ? NextText(key) : NextBinary(key);
+    if (ok)
+        count = count + 1;
+    return ok;
+}
+
+bool TraceReader::NextText(uint64_t &key) {
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        const char *first = line.data();
+        const char *last = line.data() + line.size();
+        auto [end, error] = std::from_chars(first, last, key);
+        if (error != std::errc() || end != last)
+            key = HashLine(line);
+
+        return true;
+    }
+
+    return false;
+}
+
+bool TraceReader::NextBinary(uint64_t &key) {
+    unsigned char bytes[8];
+    if (!in.read(reinterpret_cast<char *>(bytes), sizeof(bytes)))
+        return false;
+
+    // 按小端解码，与主机字节序无关
+    key = 0;
+    for (int i = 7; i >= 0; --i)
+        key = (key << 8) | bytes[i];
+
+    return true;
+}
+
+uint64_t TraceReader::HashLine(const std::string &text) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c: text) {
+        hash = hash ^ c;
+        hash = hash * 1099511628211ULL;
+    }
+    return hash;
+}
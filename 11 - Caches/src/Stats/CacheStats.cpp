@@ -0,0 +1,34 @@
+#include "Stats/CacheStats.hpp"
+
+double CacheStatsSnapshot::HitRatio() const {
+    uint64_t lookups = hits + misses;
+    if (lookups == 0)
+        return 0.0;
+
+    return static_cast<double>(hits) / static_cast<double>(lookups);
+}
+
+void CacheStats::RecordLoad(std::chrono::nanoseconds elapsed) {
+    Increment(&Stripe::loads);
+    load_latency.Record(static_cast<uint64_t>(elapsed.count()));
+}
+
+void CacheStats::RecordLoadFailure(std::chrono::nanoseconds elapsed) {
+    Increment(&Stripe::load_failures);
+    load_latency.Record(static_cast<uint64_t>(elapsed.count()));
+}
+
+CacheStatsSnapshot CacheStats::Snapshot() const {
+    CacheStatsSnapshot snapshot;
+    for (const Stripe &stripe: stripes) {
+        snapshot.hits = snapshot.hits + stripe.hits.load(std::memory_order_relaxed);
+        snapshot.misses = snapshot.misses + stripe.misses.load(std::memory_order_relaxed);
+        snapshot.evictions = snapshot.evictions + stripe.evictions.load(std::memory_order_relaxed);
+        snapshot.expirations = snapshot.expirations + stripe.expirations.load(std::memory_order_relaxed);
+        snapshot.loads = snapshot.loads + stripe.loads.load(std::memory_order_relaxed);
+        snapshot.load_failures = snapshot.load_failures + stripe.load_failures.load(std::memory_order_relaxed);
+    }
+
+    snapshot.load_latency = load_latency.Snapshot();
+    return snapshot;
+}
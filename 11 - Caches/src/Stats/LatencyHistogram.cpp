@@ -0,0 +1,72 @@
+#include "Stats/LatencyHistogram.hpp"
+
+#include <bit>
+
+HistogramSnapshot::HistogramSnapshot(std::vector<uint64_t> counts, uint64_t sum)
+    : counts(std::move(counts)), total(0), sum(sum) {
+    for (uint64_t count: this->counts)
+        total = total + count;
+}
+
+double HistogramSnapshot::Mean() const {
+    if (total == 0)
+        return 0.0;
+
+    return static_cast<double>(sum) / static_cast<double>(total);
+}
+
+uint64_t HistogramSnapshot::Percentile(double p) const {
+    if (total == 0)
+        return 0;
+
+    // 需要覆盖的记录数，至少为 1
+    double wanted = p / 100.0 * static_cast<double>(total);
+    uint64_t rank = wanted < 1.0 ? 1 : static_cast<uint64_t>(wanted);
+    if (static_cast<double>(rank) < wanted)
+        rank = rank + 1;
+    if (rank > total)
+        rank = total;
+
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < counts.size(); ++bucket) {
+        seen = seen + counts[bucket];
+        if (seen >= rank)
+            return LatencyHistogram::UpperBound(bucket);
+    }
+
+    return LatencyHistogram::UpperBound(counts.size() - 1);
+}
+
+LatencyHistogram::LatencyHistogram() : sum(0) {
+    for (auto &count: counts)
+        count.store(0, std::memory_order_relaxed);
+}
+
+HistogramSnapshot LatencyHistogram::Snapshot() const {
+    std::vector<uint64_t> copy(BUCKETS);
+    for (size_t i = 0; i < BUCKETS; ++i)
+        copy[i] = counts[i].load(std::memory_order_relaxed);
+
+    return HistogramSnapshot(std::move(copy), sum.load(std::memory_order_relaxed));
+}
+
+size_t LatencyHistogram::BucketOf(uint64_t value) {
+    if (value < SUB_BUCKETS)
+        return static_cast<size_t>(value);
+
+    // 最高位决定所在的 2 的幂区间，其后 SUB_BUCKET_BITS 位决定区间内的桶
+    int shift = std::bit_width(value) - 1 - SUB_BUCKET_BITS;
+    uint64_t mantissa = value >> shift;
+
+    return static_cast<size_t>((shift + 1) * SUB_BUCKETS + (mantissa - SUB_BUCKETS));
+}
+
+uint64_t LatencyHistogram::UpperBound(size_t bucket) {
+    if (bucket < SUB_BUCKETS)
+        return bucket;
+
+    uint64_t shift = bucket / SUB_BUCKETS - 1;
+    uint64_t mantissa = SUB_BUCKETS + bucket % SUB_BUCKETS;
+
+    return ((mantissa + 1) << shift) - 1;
+}
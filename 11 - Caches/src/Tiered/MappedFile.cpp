@@ -0,0 +1,44 @@
+#include "Tiered/MappedFile.hpp"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string &path, size_t size) : fd(-1), data(nullptr), size(0) {
+    if (size == 0)
+        return;
+
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        return;
+
+    // 文件系统不支持 fallocate 时退回稀疏文件
+    int error = ::posix_fallocate(fd, 0, static_cast<off_t>(size));
+    if (error == EOPNOTSUPP || error == EINVAL)
+        error = ::ftruncate(fd, static_cast<off_t>(size)) == 0 ? 0 : errno;
+
+    if (error != 0) {
+        ::close(fd);
+        fd = -1;
+        return;
+    }
+
+    void *mapped = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapped == MAP_FAILED) {
+        ::close(fd);
+        fd = -1;
+        return;
+    }
+
+    ::madvise(mapped, size, MADV_RANDOM);
+    data = static_cast<char *>(mapped);
+    this->size = size;
+}
+
+MappedFile::~MappedFile() {
+    if (data != nullptr)
+        ::munmap(data, size);
+    if (fd >= 0)
+        ::close(fd);
+}
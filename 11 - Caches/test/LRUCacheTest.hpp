@@ -0,0 +1,33 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <functional>
+
+// 缓存测试的公共基类
+class LRUCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 每个测试前都会运行
+        loads = 0;
+    }
+
+    void TearDown() override {
+        // 每个测试后都会运行
+    }
+
+    // 模拟慢速数据源函数
+    static int slowDataSource(const int& key) {
+        return key * 10; // 返回键的10倍作为数据
+    }
+
+    // 与 slowDataSource 返回相同的数据，同时统计访问数据源的次数；可以被多个线程同时调用
+    std::function<int(const int&)> CountingSource() {
+        return [this](const int& key) {
+            loads.fetch_add(1);
+            return slowDataSource(key);
+        };
+    }
+
+    std::atomic<int> loads;
+};
@@ -0,0 +1,244 @@
+#include <gtest/gtest.h>
+#include "../include/Async/AsyncLRUCache.hpp"
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+class AsyncLRUCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        loads = 0;
+    }
+
+    // 统计访问数据源的次数
+    std::atomic<int> loads;
+
+    // 由测试手动完成的加载：键 -> promise
+    std::mutex gate_mtx;
+    std::map<int, std::promise<int>> gates;
+
+    // 数据源返回一个由测试控制何时就绪的 future
+    AsyncLRUCache<int, int>::Loader GatedLoader() {
+        return [this](const int &key) {
+            // 先建好 promise 再计数，测试看到计数后调用 Complete 时 promise 一定已存在
+            std::lock_guard lock(gate_mtx);
+            std::future<int> future = gates[key].get_future();
+            loads.fetch_add(1);
+            return future;
+        };
+    }
+
+    // 等待数据源被调用 count 次
+    void WaitForLoads(int count) {
+        while (loads.load() < count)
+            std::this_thread::sleep_for(1ms);
+    }
+
+    void Complete(int key, int value) {
+        std::lock_guard lock(gate_mtx);
+        gates[key].set_value(value);
+        gates.erase(key);
+    }
+
+    static bool IsReady(const std::shared_future<int> &future) {
+        return future.wait_for(0s) == std::future_status::ready;
+    }
+
+    ThreadPool pool{4};
+};
+
+// 未命中时立即返回未就绪的 future，加载完成后命中立即就绪
+TEST_F(AsyncLRUCacheTest, ReturnsImmediately) {
+    AsyncLRUCache<int, int> cache(8, GatedLoader(), pool);
+
+    auto first = cache.AsyncCacheLookup(1);
+    WaitForLoads(1);
+    EXPECT_FALSE(IsReady(first));
+
+    Complete(1, 10);
+    EXPECT_EQ(first.get(), 10);
+
+    auto second = cache.AsyncCacheLookup(1);
+    EXPECT_TRUE(IsReady(second));
+    EXPECT_EQ(second.get(), 10);
+    EXPECT_EQ(loads.load(), 1);
+}
+
+// 同一个键的并发未命中共享一次加载
+TEST_F(AsyncLRUCacheTest, CoalescesMisses) {
+    AsyncLRUCache<int, int> cache(8, GatedLoader(), pool);
+
+    auto a = cache.AsyncCacheLookup(2);
+    auto b = cache.AsyncCacheLookup(2);
+    WaitForLoads(1);
+    Complete(2, 20);
+
+    EXPECT_EQ(a.get(), 20);
+    EXPECT_EQ(b.get(), 20);
+    EXPECT_EQ(loads.load(), 1);
+}
+
+// 同时进行的加载数不超过上限
+TEST_F(AsyncLRUCacheTest, BoundedInFlight) {
+    AsyncCacheOptions<int> options;
+    options.max_in_flight = 2;
+    AsyncLRUCache<int, int> cache(8, GatedLoader(), pool, options);
+
+    std::vector<std::shared_future<int>> futures;
+    for (int key = 0; key < 5; ++key)
+        futures.push_back(cache.AsyncCacheLookup(key));
+
+    WaitForLoads(2);
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(loads.load(), 2);
+    EXPECT_EQ(cache.ActiveLoads(), 2);
+
+    // 每完成一个加载，排队的下一个才开始
+    for (int key = 0; key < 5; ++key) {
+        WaitForLoads(std::min(key + 2, 5));
+        Complete(key, key * 10);
+        EXPECT_EQ(futures[key].get(), key * 10);
+    }
+    EXPECT_EQ(loads.load(), 5);
+}
+
+// 加载失败的异常传给等待者，且不被缓存
+TEST_F(AsyncLRUCacheTest, ErrorsAreNotCached) {
+    std::atomic<bool> fail{true};
+    AsyncLRUCache<int, int> cache(8, [&](const int &key) {
+        loads.fetch_add(1);
+        if (fail.load())
+            throw std::runtime_error("backend unavailable");
+        return std::async(std::launch::deferred, [key]() { return key * 10; });
+    }, pool);
+
+    auto failed = cache.AsyncCacheLookup(3);
+    EXPECT_THROW(failed.get(), std::runtime_error);
+    EXPECT_EQ(cache.Size(), 0);
+
+    fail = false;
+    EXPECT_EQ(cache.AsyncCacheLookup(3).get(), 30);
+    EXPECT_EQ(loads.load(), 2);
+}
+
+// 条目过时后命中返回旧值，同时在后台刷新
+TEST_F(AsyncLRUCacheTest, RefreshAhead) {
+    std::atomic<int> now_ms{0};
+    AsyncCacheOptions<int> options;
+    options.refresh_after = 100ms;
+    options.now = [&now_ms]() {
+        return AsyncCacheOptions<int>::Clock::time_point(std::chrono::milliseconds(now_ms.load()));
+    };
+
+    std::atomic<int> version{0};
+    AsyncLRUCache<int, int> cache(8, [&](const int &) {
+        loads.fetch_add(1);
+        int value = version.fetch_add(1);
+        return std::async(std::launch::deferred, [value]() { return value; });
+    }, pool, options);
+
+    EXPECT_EQ(cache.AsyncCacheLookup(1).get(), 0);
+
+    // 尚未过时：不刷新
+    now_ms = 50;
+    EXPECT_EQ(cache.AsyncCacheLookup(1).get(), 0);
+    EXPECT_EQ(loads.load(), 1);
+
+    // 过时：立即返回旧值并触发后台刷新
+    now_ms = 150;
+    auto stale = cache.AsyncCacheLookup(1);
+    EXPECT_TRUE(IsReady(stale));
+    EXPECT_EQ(stale.get(), 0);
+
+    WaitForLoads(2);
+    while (cache.ActiveLoads() != 0)
+        std::this_thread::sleep_for(1ms);
+    EXPECT_EQ(cache.AsyncCacheLookup(1).get(), 1);
+}
+
+// 回调式数据源不占用执行器线程：一个线程也能同时进行 max_in_flight 个加载
+TEST_F(AsyncLRUCacheTest, CallbackLoaderDoesNotBlockExecutor) {
+    ThreadPool single(1);
+    std::mutex done_mtx;
+    std::map<int, AsyncLRUCache<int, int>::Done> pending;
+
+    AsyncCacheOptions<int> options;
+    options.max_in_flight = 4;
+    AsyncLRUCache<int, int> cache(8, [&](const int &key, AsyncLRUCache<int, int>::Done done,
+                                         AsyncLRUCache<int, int>::Fail fail) {
+        std::lock_guard lock(done_mtx);
+        if (key < 0) {
+            fail(std::make_exception_ptr(std::runtime_error("negative key")));
+            return;
+        }
+        pending.emplace(key, std::move(done));
+        loads.fetch_add(1);
+    }, single, options);
+
+    std::vector<std::shared_future<int>> futures;
+    for (int key = 0; key < 4; ++key)
+        futures.push_back(cache.AsyncCacheLookup(key));
+    WaitForLoads(4);
+    EXPECT_EQ(cache.ActiveLoads(), 4);
+
+    // 在测试线程上完成加载，如同异步客户端的 I/O 线程
+    std::map<int, AsyncLRUCache<int, int>::Done> ready;
+    {
+        std::lock_guard lock(done_mtx);
+        ready.swap(pending);
+    }
+    for (auto &[key, done]: ready)
+        done(key * 10);
+
+    for (int key = 0; key < 4; ++key)
+        EXPECT_EQ(futures[key].get(), key * 10);
+    EXPECT_EQ(cache.ActiveLoads(), 0);
+
+    auto failed = cache.AsyncCacheLookup(-1);
+    EXPECT_THROW(failed.get(), std::runtime_error);
+}
+
+// 回调式查找：命中时立即调用，未命中时在加载完成时调用，不需要线程等待 future
+TEST_F(AsyncLRUCacheTest, LookupWithCallbacks) {
+    AsyncLRUCache<int, int> cache(8, GatedLoader(), pool);
+
+    std::atomic<int> result{0};
+    std::atomic<int> errors{0};
+    auto done = [&result](int value) { result.store(value); };
+    auto fail = [&errors](std::exception_ptr) { errors.fetch_add(1); };
+
+    cache.AsyncCacheLookup(3, done, fail);
+    auto shared = cache.AsyncCacheLookup(3);
+    WaitForLoads(1);
+    EXPECT_EQ(result.load(), 0);
+
+    Complete(3, 30);
+    EXPECT_EQ(shared.get(), 30);
+    while (result.load() == 0)
+        std::this_thread::sleep_for(1ms);
+    EXPECT_EQ(result.load(), 30);
+
+    // 命中：在调用线程上立即完成
+    result.store(0);
+    cache.AsyncCacheLookup(3, done, fail);
+    EXPECT_EQ(result.load(), 30);
+    EXPECT_EQ(loads.load(), 1);
+
+    // 失败
+    cache.AsyncCacheLookup(4, done, fail);
+    WaitForLoads(2);
+    {
+        std::lock_guard lock(gate_mtx);
+        gates[4].set_exception(std::make_exception_ptr(std::runtime_error("source down")));
+        gates.erase(4);
+    }
+    while (errors.load() == 0)
+        std::this_thread::sleep_for(1ms);
+    EXPECT_EQ(errors.load(), 1);
+    EXPECT_EQ(result.load(), 30);
+}
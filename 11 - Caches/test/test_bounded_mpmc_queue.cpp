@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include "../include/Queue/BoundedMPMCQueue.hpp"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 容量向上取整为 2 的幂
+TEST(BoundedMPMCQueueTest, CapacityRoundsUp) {
+    EXPECT_EQ(BoundedMPMCQueue<int>(0).Capacity(), 2);
+    EXPECT_EQ(BoundedMPMCQueue<int>(1).Capacity(), 2);
+    EXPECT_EQ(BoundedMPMCQueue<int>(8).Capacity(), 8);
+    EXPECT_EQ(BoundedMPMCQueue<int>(9).Capacity(), 16);
+}
+
+// 单线程下先进先出，满时入队失败、空时出队失败
+TEST(BoundedMPMCQueueTest, FifoAndBounds) {
+    BoundedMPMCQueue<int> queue(4);
+    EXPECT_FALSE(queue.TryDequeue().has_value());
+
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(queue.TryEnqueue(i));
+    EXPECT_FALSE(queue.TryEnqueue(4));
+    EXPECT_EQ(queue.SizeApprox(), 4);
+
+    for (int round = 0; round < 10; ++round) {
+        EXPECT_EQ(queue.TryDequeue(), round);
+        EXPECT_TRUE(queue.TryEnqueue(round + 4));
+    }
+
+    for (int i = 10; i < 14; ++i)
+        EXPECT_EQ(queue.TryDequeue(), i);
+    EXPECT_FALSE(queue.TryDequeue().has_value());
+    EXPECT_EQ(queue.SizeApprox(), 0);
+}
+
+// 只能移动的类型
+TEST(BoundedMPMCQueueTest, MoveOnly) {
+    BoundedMPMCQueue<std::unique_ptr<int>> queue(2);
+    EXPECT_TRUE(queue.TryEnqueue(std::make_unique<int>(7)));
+    queue.Enqueue(std::make_unique<int>(8));
+
+    auto rejected = std::make_unique<int>(9);
+    EXPECT_FALSE(queue.TryEnqueue(std::move(rejected)));
+    ASSERT_NE(rejected, nullptr); // 入队失败时值未被移走
+
+    EXPECT_EQ(*queue.Dequeue(), 7);
+    EXPECT_EQ(*queue.TryDequeue().value(), 8);
+}
+
+// 析构时剩余的值被析构
+TEST(BoundedMPMCQueueTest, DestroysRemaining) {
+    auto tracker = std::make_shared<int>(0);
+    {
+        BoundedMPMCQueue<std::shared_ptr<int>> queue(8);
+        for (int i = 0; i < 5; ++i)
+            queue.Enqueue(tracker);
+        queue.Dequeue();
+        EXPECT_EQ(tracker.use_count(), 5);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+// 批量操作：空间不足时只处理能放下的前缀
+TEST(BoundedMPMCQueueTest, Batch) {
+    BoundedMPMCQueue<std::string> queue(4);
+    std::vector<std::string> values = {"a", "b", "c", "d", "e", "f"};
+
+    EXPECT_EQ(queue.TryEnqueueBatch(values), 4);
+    EXPECT_EQ(queue.TryEnqueueBatch(values), 0);
+
+    std::vector<std::string> out(3);
+    EXPECT_EQ(queue.TryDequeueBatch(out), 3);
+    EXPECT_EQ(out, (std::vector<std::string>{"a", "b", "c"}));
+
+    EXPECT_EQ(queue.TryEnqueueBatch(std::span<const std::string>(values).subspan(4)), 2);
+    EXPECT_EQ(queue.TryDequeueBatch(out), 3);
+    EXPECT_EQ(out, (std::vector<std::string>{"d", "e", "f"}));
+    EXPECT_EQ(queue.TryDequeueBatch(out), 0);
+}
+
+// 多个生产者、多个消费者：每个值恰好被取出一次，同一个生产者的值按顺序到达每个消费者
+TEST(BoundedMPMCQueueTest, ConcurrentProducersConsumers) {
+    constexpr int PRODUCERS = 4;
+    constexpr int CONSUMERS = 4;
+    constexpr int PER_PRODUCER = 20000;
+
+    BoundedMPMCQueue<int> queue(64);
+    std::vector<std::atomic<int>> seen(PRODUCERS * PER_PRODUCER);
+    std::atomic<bool> ordered{true};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        threads.emplace_back([&queue, p]() {
+            // 每 8 个一组，单个入队与批量入队交替进行
+            std::vector<int> batch;
+            for (int begin = 0; begin < PER_PRODUCER; begin += 8) {
+                batch.clear();
+                for (int i = begin; i < begin + 8 && i < PER_PRODUCER; ++i)
+                    batch.push_back(p * PER_PRODUCER + i);
+
+                if (begin / 8 % 2 == 0) {
+                    for (int value: batch)
+                        queue.Enqueue(value);
+                } else {
+                    queue.EnqueueBatch(batch);
+                }
+            }
+        });
+    }
+
+    std::atomic<int> consumed{0};
+    for (int c = 0; c < CONSUMERS; ++c) {
+        threads.emplace_back([&, c]() {
+            std::vector<int> last(PRODUCERS, -1);
+            std::vector<int> out(5);
+            auto record = [&](int value) {
+                int producer = value / PER_PRODUCER;
+                if (value <= last[producer])
+                    ordered = false;
+                last[producer] = value;
+                seen[value].fetch_add(1);
+            };
+
+            while (consumed.load() < PRODUCERS * PER_PRODUCER) {
+                if (c % 2 == 0) {
+                    auto value = queue.TryDequeue();
+                    if (!value.has_value()) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    record(value.value());
+                    consumed.fetch_add(1);
+                } else {
+                    size_t count = queue.TryDequeueBatch(out);
+                    if (count == 0) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    for (size_t i = 0; i < count; ++i)
+                        record(out[i]);
+                    consumed.fetch_add(static_cast<int>(count));
+                }
+            }
+        });
+    }
+
+    for (auto &thread: threads)
+        thread.join();
+
+    EXPECT_TRUE(ordered.load());
+    for (size_t i = 0; i < seen.size(); ++i)
+        ASSERT_EQ(seen[i].load(), 1) << i;
+    EXPECT_EQ(queue.SizeApprox(), 0);
+}
+
+// 阻塞的 Enqueue/Dequeue 在满/空时睡眠，对方发布槽后被唤醒
+TEST(BoundedMPMCQueueTest, BlockingWaitersWake) {
+    constexpr int THREADS = 2;
+    constexpr int PER_THREAD = 20000;
+
+    BoundedMPMCQueue<int> queue(2);
+    std::atomic<long long> sum{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&queue]() {
+            for (int i = 1; i <= PER_THREAD; ++i)
+                queue.Enqueue(i);
+        });
+        threads.emplace_back([&queue, &sum]() {
+            for (int i = 0; i < PER_THREAD; ++i)
+                sum.fetch_add(queue.Dequeue());
+        });
+    }
+
+    // 消费者先于生产者进入空队列等待
+    BoundedMPMCQueue<int> empty(4);
+    std::thread late([&empty, &sum]() { sum.fetch_add(empty.Dequeue()); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    empty.Enqueue(7);
+    late.join();
+
+    for (auto &thread: threads)
+        thread.join();
+
+    EXPECT_EQ(sum.load(), 7 + static_cast<long long>(THREADS) * PER_THREAD * (PER_THREAD + 1) / 2);
+    EXPECT_EQ(queue.SizeApprox(), 0u);
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "../include/LRU/LRUCache.hpp"
+#include "../include/Stats/CacheStats.hpp"
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using StatsCache = LRUCache<int, int, LRUPolicy<int>, CacheStats>;
+
+// 未启用统计时统计对象是空类型
+static_assert(std::is_empty_v<NullCacheStats>);
+
+// 小于 32 的值精确记录，更大的值相对误差不超过 1/32
+TEST(LatencyHistogramTest, BucketPrecision) {
+    for (uint64_t value = 0; value < 32; ++value)
+        EXPECT_EQ(LatencyHistogram::UpperBound(LatencyHistogram::BucketOf(value)), value);
+
+    for (uint64_t value: {32ull, 33ull, 100ull, 1000ull, 123456ull, 987654321ull, 1ull << 40}) {
+        uint64_t upper = LatencyHistogram::UpperBound(LatencyHistogram::BucketOf(value));
+        EXPECT_GE(upper, value);
+        EXPECT_LE(upper - value, value / 32);
+    }
+
+    EXPECT_LT(LatencyHistogram::BucketOf(UINT64_MAX), LatencyHistogram::BUCKETS);
+    EXPECT_EQ(LatencyHistogram::UpperBound(LatencyHistogram::BucketOf(UINT64_MAX)), UINT64_MAX);
+}
+
+// 桶序号随值单调不减
+TEST(LatencyHistogramTest, BucketsAreMonotonic) {
+    size_t previous = 0;
+    for (uint64_t value = 0; value < 100000; value += 7) {
+        size_t bucket = LatencyHistogram::BucketOf(value);
+        EXPECT_GE(bucket, previous);
+        previous = bucket;
+    }
+}
+
+// 百分位数落在对应记录值的桶内
+TEST(LatencyHistogramTest, Percentiles) {
+    LatencyHistogram histogram;
+    for (uint64_t value = 1; value <= 1000; ++value)
+        histogram.Record(value * 1000);
+
+    HistogramSnapshot snapshot = histogram.Snapshot();
+    EXPECT_EQ(snapshot.Count(), 1000);
+    EXPECT_DOUBLE_EQ(snapshot.Mean(), 500500.0);
+
+    for (double p: {1.0, 50.0, 90.0, 99.0, 100.0}) {
+        auto exact = static_cast<uint64_t>(p * 10) * 1000;
+        EXPECT_GE(snapshot.Percentile(p), exact) << p;
+        EXPECT_LE(snapshot.Percentile(p), exact + exact / 32) << p;
+    }
+    EXPECT_EQ(snapshot.Max(), snapshot.Percentile(100.0));
+
+    EXPECT_EQ(HistogramSnapshot().Percentile(50.0), 0);
+}
+
+// 缓存记录命中、未命中、淘汰与加载
+TEST(CacheStatsTest, CountsLookups) {
+    StatsCache cache(2, [](const int &key) { return key * 10; });
+    cache.CacheLookup(1);
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    cache.CacheLookup(3); // 淘汰 1
+    cache.CacheLookup(2);
+
+    CacheStatsSnapshot snapshot = cache.Statistics().Snapshot();
+    EXPECT_EQ(snapshot.hits, 2);
+    EXPECT_EQ(snapshot.misses, 3);
+    EXPECT_EQ(snapshot.evictions, 1);
+    EXPECT_EQ(snapshot.loads, 3);
+    EXPECT_EQ(snapshot.load_failures, 0);
+    EXPECT_EQ(snapshot.load_latency.Count(), 3);
+    EXPECT_DOUBLE_EQ(snapshot.HitRatio(), 0.4);
+}
+
+// 数据源延迟被记录在直方图中
+TEST(CacheStatsTest, RecordsLoadLatency) {
+    StatsCache cache(4, [](const int &key) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        return key;
+    });
+    cache.CacheLookup(1);
+
+    HistogramSnapshot latency = cache.Statistics().Snapshot().load_latency;
+    EXPECT_EQ(latency.Count(), 1);
+    EXPECT_GE(latency.Max(), 2000000);
+}
+
+// 加载失败单独计数
+TEST(CacheStatsTest, CountsFailures) {
+    StatsCache cache(4, [](const int &) -> int { throw std::runtime_error("backend unavailable"); });
+    EXPECT_THROW(cache.CacheLookup(1), std::runtime_error);
+
+    CacheStatsSnapshot snapshot = cache.Statistics().Snapshot();
+    EXPECT_EQ(snapshot.misses, 1);
+    EXPECT_EQ(snapshot.loads, 0);
+    EXPECT_EQ(snapshot.load_failures, 1);
+}
+
+// 过期回收与批量查找同样计入统计
+TEST(CacheStatsTest, CountsExpirationsAndBatches) {
+    std::chrono::steady_clock::time_point now{};
+    LRUCacheOptions<int, int> options;
+    options.expire_after_write = std::chrono::seconds(1);
+    options.now = [&now]() { return now; };
+    options.bulk_source = [](std::span<const int> keys) { return std::vector<int>(keys.begin(), keys.end()); };
+
+    StatsCache cache(8, [](const int &key) { return key; }, options);
+    std::vector<int> keys = {1, 2, 3};
+    cache.CacheLookupMany(keys);
+    cache.CacheLookupMany(keys);
+
+    now += std::chrono::seconds(1);
+    EXPECT_EQ(cache.Cleanup(), 3);
+
+    CacheStatsSnapshot snapshot = cache.Statistics().Snapshot();
+    EXPECT_EQ(snapshot.hits, 3);
+    EXPECT_EQ(snapshot.misses, 3);
+    EXPECT_EQ(snapshot.loads, 1);
+    EXPECT_EQ(snapshot.expirations, 3);
+}
+
+// 多个线程同时记录，汇总结果不丢失
+TEST(CacheStatsTest, ConcurrentRecording) {
+    CacheStats stats;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&stats]() {
+            for (int i = 0; i < 10000; ++i) {
+                stats.RecordHit();
+                stats.RecordMiss();
+            }
+        });
+    }
+    for (auto &thread: threads)
+        thread.join();
+
+    CacheStatsSnapshot snapshot = stats.Snapshot();
+    EXPECT_EQ(snapshot.hits, 80000);
+    EXPECT_EQ(snapshot.misses, 80000);
+}
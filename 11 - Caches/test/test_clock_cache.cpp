@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include "../include/CLOCK/ClockCache.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ClockCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        loads.clear();
+        cache = std::make_unique<ClockCache<int, int>>(3, [this](const int &key) {
+            loads.push_back(key);
+            return key * 10;
+        });
+    }
+
+    // 记录每次访问慢速数据源的键，用来判断命中与淘汰
+    std::vector<int> loads;
+    std::unique_ptr<ClockCache<int, int>> cache;
+};
+
+// 基本操作测试
+TEST_F(ClockCacheTest, BasicLookup) {
+    EXPECT_EQ(cache->CacheLookup(1), 10);
+    EXPECT_EQ(cache->CacheLookup(1), 10);
+    EXPECT_EQ(loads, std::vector<int>({1}));
+    EXPECT_EQ(cache->Size(), 1);
+}
+
+// 被访问过的条目获得第二次机会
+TEST_F(ClockCacheTest, SecondChance) {
+    cache->CacheLookup(1);
+    cache->CacheLookup(2);
+    cache->CacheLookup(3);
+    cache->CacheLookup(1); // 键1的访问位置 1
+
+    // 指针跳过键1（清零访问位），淘汰键2
+    cache->CacheLookup(4);
+
+    loads.clear();
+    EXPECT_EQ(cache->CacheLookup(1), 10);
+    EXPECT_EQ(cache->CacheLookup(3), 30);
+    EXPECT_EQ(cache->CacheLookup(4), 40);
+    EXPECT_TRUE(loads.empty());
+
+    EXPECT_EQ(cache->CacheLookup(2), 20);
+    EXPECT_EQ(loads, std::vector<int>({2}));
+}
+
+// 所有访问位都为 1 时退化为 FIFO
+TEST_F(ClockCacheTest, AllReferenced) {
+    cache->CacheLookup(1);
+    cache->CacheLookup(2);
+    cache->CacheLookup(3);
+    cache->CacheLookup(1);
+    cache->CacheLookup(2);
+    cache->CacheLookup(3);
+
+    cache->CacheLookup(4); // 转一圈后淘汰键1
+
+    loads.clear();
+    cache->CacheLookup(1);
+    EXPECT_EQ(loads, std::vector<int>({1}));
+    EXPECT_EQ(cache->Size(), 3);
+}
+
+// 容量为0时不缓存任何数据
+TEST_F(ClockCacheTest, ZeroCapacity) {
+    ClockCache<int, int> empty(0, [](const int &key) { return key; });
+    EXPECT_EQ(empty.CacheLookup(7), 7);
+    EXPECT_EQ(empty.Size(), 0);
+}
+
+// 多线程并发访问结果正确
+TEST_F(ClockCacheTest, ConcurrentLookups) {
+    std::atomic<int> calls{0};
+    ClockCache<int, int> shared(128, [&calls](const int &key) {
+        calls.fetch_add(1);
+        return key * 10;
+    });
+    std::atomic<int> errors{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < 20000; ++i) {
+                int key = (i * 13 + t) % 192;
+                if (shared.CacheLookup(key) != key * 10)
+                    errors.fetch_add(1);
+            }
+        });
+    }
+    for (auto &thread: threads)
+        thread.join();
+
+    EXPECT_EQ(errors.load(), 0);
+    EXPECT_EQ(shared.Size(), 128);
+    EXPECT_LT(calls.load(), 4 * 20000);
+}
+
+// 大量淘汰时并发命中：节点回收复用、索引重建期间读到的值始终与键一致
+TEST_F(ClockCacheTest, ConcurrentChurn) {
+    ClockCache<int, std::string> shared(64, [](const int &key) {
+        return "value_" + std::to_string(key);
+    });
+    std::atomic<int> errors{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < 20000; ++i) {
+                // 一半访问热点键，一半访问大范围的冷键，制造持续的淘汰
+                int key = (i % 2 == 0) ? i % 16 : (i * 7919 + t) % 5000;
+                if (shared.CacheLookup(key) != "value_" + std::to_string(key))
+                    errors.fetch_add(1);
+            }
+        });
+    }
+    for (auto &thread: threads)
+        thread.join();
+
+    EXPECT_EQ(errors.load(), 0);
+    EXPECT_EQ(shared.Size(), 64);
+    for (int key = 0; key < 16; ++key)
+        EXPECT_EQ(shared.CacheLookup(key), "value_" + std::to_string(key));
+}
+
+// 字符串类型缓存测试
+TEST_F(ClockCacheTest, StringCache) {
+    ClockCache<std::string, std::string> strings(2, [](const std::string &key) {
+        return "value_" + key;
+    });
+    EXPECT_EQ(strings.CacheLookup("key1"), "value_key1");
+    EXPECT_EQ(strings.CacheLookup("key2"), "value_key2");
+    EXPECT_EQ(strings.CacheLookup("key3"), "value_key3");
+    EXPECT_EQ(strings.Size(), 2);
+}
@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+#include "../include/LRU/LRUCache.hpp"
+#include "../include/Policy/SLRUPolicy.hpp"
+#include "../include/Policy/ARCPolicy.hpp"
+#include "LRUCacheTest.hpp"
+#include <chrono>
+#include <string>
+#include <vector>
+
+// 所有策略共用的测试
+template<typename Policy>
+class EvictionPolicyTest : public LRUCacheTest {};
+
+using Policies = ::testing::Types<LRUPolicy<int>, SLRUPolicy<int>, ARCPolicy<int>>;
+TYPED_TEST_SUITE(EvictionPolicyTest, Policies);
+
+// 基本操作测试
+TYPED_TEST(EvictionPolicyTest, BasicLookup) {
+    LRUCache<int, int, TypeParam> cache(3, this->CountingSource());
+    EXPECT_EQ(cache.CacheLookup(1), 10);
+    EXPECT_EQ(cache.CacheLookup(1), 10);
+    EXPECT_EQ(this->loads, 1);
+}
+
+// 条目数不超过容量，结果始终正确
+TYPED_TEST(EvictionPolicyTest, CapacityBound) {
+    LRUCache<int, int, TypeParam> cache(8, this->CountingSource());
+    for (int i = 0; i < 500; ++i) {
+        int key = (i * 7) % 23;
+        EXPECT_EQ(cache.CacheLookup(key), key * 10);
+        EXPECT_LE(cache.Size(), 8);
+    }
+}
+
+// 容量为1的缓存测试
+TYPED_TEST(EvictionPolicyTest, SingleCapacity) {
+    LRUCache<int, int, TypeParam> cache(1, this->CountingSource());
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    cache.CacheLookup(2);
+    EXPECT_EQ(this->loads, 2);
+    EXPECT_EQ(cache.CacheLookup(1), 10);
+    EXPECT_EQ(this->loads, 3);
+}
+
+// 过期条目从策略中移除后，容量和淘汰仍然正确
+TYPED_TEST(EvictionPolicyTest, ExpiredEntriesLeavePolicy) {
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point now{};
+
+    LRUCacheOptions<int, int> options;
+    options.expiry = [](const int &key, const int &) {
+        return key % 2 == 0 ? std::chrono::seconds(10) : Clock::duration::max();
+    };
+    options.now = [&now]() { return now; };
+
+    LRUCache<int, int, TypeParam> cache(4, this->CountingSource(), options);
+    for (int key = 1; key <= 4; ++key)
+        cache.CacheLookup(key);
+
+    now += std::chrono::seconds(10);
+    EXPECT_EQ(cache.Cleanup(), 2);
+    EXPECT_EQ(cache.Size(), 2);
+
+    for (int i = 0; i < 200; ++i) {
+        int key = (i * 5) % 13;
+        EXPECT_EQ(cache.CacheLookup(key), key * 10);
+        EXPECT_LE(cache.Size(), 4);
+    }
+}
+
+// 字符串类型缓存测试
+TYPED_TEST(EvictionPolicyTest, StringCache) {
+    using StringPolicy = typename std::conditional_t<
+        std::is_same_v<TypeParam, LRUPolicy<int>>, LRUPolicy<std::string>,
+        std::conditional_t<std::is_same_v<TypeParam, SLRUPolicy<int>>, SLRUPolicy<std::string>, ARCPolicy<std::string>>>;
+
+    LRUCache<std::string, std::string, StringPolicy> cache(2, [](const std::string &key) {
+        return "value_" + key;
+    });
+    EXPECT_EQ(cache.CacheLookup("key1"), "value_key1");
+    EXPECT_EQ(cache.CacheLookup("key2"), "value_key2");
+    EXPECT_EQ(cache.CacheLookup("key3"), "value_key3");
+    EXPECT_EQ(cache.Size(), 2);
+}
+
+class PolicySpecificTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        loads.clear();
+    }
+
+    // 记录每次访问慢速数据源的键
+    std::vector<int> loads;
+
+    std::function<int(const int &)> RecordingSource() {
+        return [this](const int &key) {
+            loads.push_back(key);
+            return key * 10;
+        };
+    }
+};
+
+// SLRU：访问过两次的键不会被一次性扫描挤掉
+TEST_F(PolicySpecificTest, SLRUScanResistance) {
+    LRUCache<int, int, SLRUPolicy<int>> cache(5, RecordingSource());
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+
+    for (int key = 100; key < 120; ++key)
+        cache.CacheLookup(key);
+
+    loads.clear();
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    EXPECT_TRUE(loads.empty());
+}
+
+// SLRU：保护段溢出时降级回试用段而不是直接淘汰
+TEST_F(PolicySpecificTest, SLRUDemotion) {
+    // 容量 5，保护段 4
+    LRUCache<int, int, SLRUPolicy<int>> cache(5, RecordingSource());
+    for (int key = 1; key <= 5; ++key)
+        cache.CacheLookup(key);
+    for (int key = 1; key <= 5; ++key)
+        cache.CacheLookup(key); // 键1被降级回试用段
+
+    cache.CacheLookup(6); // 淘汰试用段队首：键1
+
+    loads.clear();
+    for (int key = 2; key <= 6; ++key)
+        cache.CacheLookup(key);
+    EXPECT_TRUE(loads.empty());
+}
+
+// ARC：访问过两次的键不会被一次性扫描挤掉
+TEST_F(PolicySpecificTest, ARCScanResistance) {
+    LRUCache<int, int, ARCPolicy<int>> cache(5, RecordingSource());
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+
+    for (int key = 100; key < 120; ++key)
+        cache.CacheLookup(key);
+
+    loads.clear();
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    EXPECT_TRUE(loads.empty());
+}
+
+// ARC：幽灵列表命中时调整目标值
+TEST_F(PolicySpecificTest, ARCAdaptsTarget) {
+    ARCPolicy<int> policy(4);
+
+    // 键1进入 T2，键2、3、4进入 T1
+    policy.OnMiss(1);
+    auto first = policy.OnInsert(1);
+    policy.OnHit(first);
+    for (int key = 2; key <= 4; ++key) {
+        policy.OnMiss(key);
+        policy.OnInsert(key);
+    }
+
+    // 缓存已满，淘汰 T1 队首（键2）进入 B1
+    policy.OnMiss(5);
+    EXPECT_EQ(policy.Victim(), std::optional<int>(2));
+    policy.OnInsert(5);
+    EXPECT_EQ(policy.Target(), 0);
+
+    // 键2在 B1 中被再次请求：T1 目标增大，键2直接进入 T2
+    policy.OnMiss(2);
+    EXPECT_EQ(policy.Target(), 1);
+    EXPECT_EQ(policy.Victim(), std::optional<int>(3));
+    auto node = policy.OnInsert(2);
+    EXPECT_EQ(node->list, ARCList::T2);
+
+    // 键3在 B1 中，再次请求时目标继续增大
+    policy.OnMiss(3);
+    EXPECT_EQ(policy.Target(), 2);
+}
+
+// SLRU、ARC 的内部大小按条目数计算，不能与 weigher 一起使用
+TEST_F(PolicySpecificTest, WeigherRequiresLRU) {
+    LRUCacheOptions<int, int> options;
+    options.weigher = [](const int &, const int &) { return size_t{4}; };
+
+    using SLRUCache = LRUCache<int, int, SLRUPolicy<int>>;
+    using ARCCache = LRUCache<int, int, ARCPolicy<int>>;
+    EXPECT_THROW(SLRUCache(16, RecordingSource(), options), std::invalid_argument);
+    EXPECT_THROW(ARCCache(16, RecordingSource(), options), std::invalid_argument);
+
+    LRUCache<int, int> cache(16, RecordingSource(), options);
+    for (int key = 0; key < 10; ++key)
+        cache.CacheLookup(key);
+    EXPECT_EQ(cache.Size(), 4);
+}
+
+// ARC：OnMiss 之后没有插入（例如数据源抛出异常），后续插入其他键不受影响
+TEST_F(PolicySpecificTest, ARCMissWithoutInsert) {
+    ARCPolicy<int> policy(2);
+
+    // 键1进入 T2，键2进入 T1 后被淘汰到 B1
+    policy.OnMiss(1);
+    auto first = policy.OnInsert(1);
+    policy.OnHit(first);
+    policy.OnMiss(2);
+    policy.OnInsert(2);
+    policy.OnMiss(3);
+    EXPECT_EQ(policy.Victim(), std::optional<int>(2));
+    policy.OnInsert(3);
+
+    // 键2在 B1 中被请求，但这次未命中没有插入
+    policy.OnMiss(2);
+
+    // 不在幽灵列表中的键进入 T1
+    policy.OnMiss(4);
+    EXPECT_EQ(policy.Victim(), std::optional<int>(1));
+    auto fresh = policy.OnInsert(4);
+    EXPECT_EQ(fresh->list, ARCList::T1);
+
+    // 不经过 OnMiss 直接插入 B2 中的键1，仍然按键找到它并放入 T2
+    EXPECT_EQ(policy.Victim(), std::optional<int>(3));
+    auto ghost = policy.OnInsert(1);
+    EXPECT_EQ(ghost->list, ARCList::T2);
+}
+
+// ARC：T2 中的键被淘汰后进入 B2，再次请求时目标减小
+TEST_F(PolicySpecificTest, ARCGhostB2) {
+    ARCPolicy<int> policy(2);
+
+    // 键1进入 T2，键2进入 T1
+    policy.OnMiss(1);
+    auto node = policy.OnInsert(1);
+    policy.OnHit(node);
+    policy.OnMiss(2);
+    policy.OnInsert(2);
+
+    // 键3挤掉 T1 中的键2，键2进入 B1
+    policy.OnMiss(3);
+    EXPECT_EQ(policy.Victim(), std::optional<int>(2));
+    policy.OnInsert(3);
+
+    // 键2在 B1 中：目标增大到 1，此时 T1 未超过目标，淘汰 T2 中的键1进入 B2
+    policy.OnMiss(2);
+    EXPECT_EQ(policy.Target(), 1);
+    EXPECT_EQ(policy.Victim(), std::optional<int>(1));
+    policy.OnInsert(2);
+
+    // 键1在 B2 中：目标减小
+    policy.OnMiss(1);
+    EXPECT_EQ(policy.Target(), 0);
+}
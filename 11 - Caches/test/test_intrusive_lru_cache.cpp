@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include "../include/LRU/IntrusiveLRUCache.hpp"
+#include <string>
+#include <vector>
+
+class IntrusiveLRUCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        loads.clear();
+        cache = std::make_unique<IntrusiveLRUCache<int, int>>(3, [this](const int &key) {
+            loads.push_back(key);
+            return key * 10;
+        });
+    }
+
+    // 记录每次访问慢速数据源的键，用来判断命中与淘汰
+    std::vector<int> loads;
+    std::unique_ptr<IntrusiveLRUCache<int, int>> cache;
+};
+
+// 基本操作测试
+TEST_F(IntrusiveLRUCacheTest, BasicLookup) {
+    EXPECT_EQ(cache->CacheLookup(1), 10);
+    EXPECT_EQ(cache->CacheLookup(1), 10);
+    EXPECT_EQ(loads, std::vector<int>({1}));
+    EXPECT_EQ(cache->Size(), 1);
+}
+
+// LRU顺序验证
+TEST_F(IntrusiveLRUCacheTest, LRUOrder) {
+    cache->CacheLookup(1);
+    cache->CacheLookup(2);
+    cache->CacheLookup(3);
+    cache->CacheLookup(1); // 队列: [2, 3, 1]
+    cache->CacheLookup(4); // 队列: [3, 1, 4], 键2被移除
+
+    loads.clear();
+    EXPECT_EQ(cache->CacheLookup(3), 30);
+    EXPECT_EQ(cache->CacheLookup(1), 10);
+    EXPECT_EQ(cache->CacheLookup(4), 40);
+    EXPECT_TRUE(loads.empty());
+
+    EXPECT_EQ(cache->CacheLookup(2), 20);
+    EXPECT_EQ(loads, std::vector<int>({2}));
+    EXPECT_EQ(cache->Size(), 3);
+}
+
+// 同一个桶内的多个条目淘汰后链表保持正确
+TEST_F(IntrusiveLRUCacheTest, BucketCollisions) {
+    // 容量 3 对应 4 个桶，0/4/8/12 落在同一个桶
+    cache->CacheLookup(0);
+    cache->CacheLookup(4);
+    cache->CacheLookup(8);
+    cache->CacheLookup(4);
+    cache->CacheLookup(12); // 键0被移除
+
+    loads.clear();
+    EXPECT_EQ(cache->CacheLookup(4), 40);
+    EXPECT_EQ(cache->CacheLookup(8), 80);
+    EXPECT_EQ(cache->CacheLookup(12), 120);
+    EXPECT_TRUE(loads.empty());
+
+    EXPECT_EQ(cache->CacheLookup(0), 0);
+    EXPECT_EQ(loads, std::vector<int>({0}));
+}
+
+// 数据源抛出异常时缓存不变
+TEST_F(IntrusiveLRUCacheTest, SourceThrows) {
+    IntrusiveLRUCache<int, int> throwing(2, [](const int &key) -> int {
+        if (key < 0)
+            throw std::runtime_error("bad key");
+        return key;
+    });
+    throwing.CacheLookup(1);
+    EXPECT_THROW(throwing.CacheLookup(-1), std::runtime_error);
+    EXPECT_EQ(throwing.Size(), 1);
+    EXPECT_EQ(throwing.CacheLookup(1), 1);
+}
+
+// 容量为0时不缓存任何数据
+TEST_F(IntrusiveLRUCacheTest, ZeroCapacity) {
+    int calls = 0;
+    IntrusiveLRUCache<int, int> empty(0, [&calls](const int &key) {
+        calls = calls + 1;
+        return key;
+    });
+    empty.CacheLookup(1);
+    empty.CacheLookup(1);
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(empty.Size(), 0);
+}
+
+// 字符串类型缓存测试
+TEST_F(IntrusiveLRUCacheTest, StringCache) {
+    IntrusiveLRUCache<std::string, std::string> strings(2, [](const std::string &key) {
+        return "value_" + key;
+    });
+    EXPECT_EQ(strings.CacheLookup("key1"), "value_key1");
+    EXPECT_EQ(strings.CacheLookup("key2"), "value_key2");
+    EXPECT_EQ(strings.CacheLookup("key1"), "value_key1");
+    EXPECT_EQ(strings.CacheLookup("key3"), "value_key3");
+    EXPECT_EQ(strings.Size(), 2);
+}
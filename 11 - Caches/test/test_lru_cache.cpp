@@ -1,22 +1,11 @@
 #include <gtest/gtest.h>
 #include "../include/LRU/LRUCache.hpp"
+#include "LRUCacheTest.hpp"
+#include <chrono>
+#include <span>
+#include <stdexcept>
 #include <string>
-
-class LRUCacheTest : public ::testing::Test {
-protected:
-    void SetUp() override {
-        // 每个测试前都会运行
-    }
-
-    void TearDown() override {
-        // 每个测试后都会运行
-    }
-
-    // 模拟慢速数据源函数
-    static int slowDataSource(const int& key) {
-        return key * 10; // 返回键的10倍作为数据
-    }
-};
+#include <vector>
 
 // 测试用例类：整数键和整数值
 class IntIntCacheTest : public LRUCacheTest {
@@ -167,3 +156,390 @@ TEST_F(IntIntCacheTest, MultipleInsertionsAndAccess) {
     // 验证功能正常
     EXPECT_EQ(cache->CacheLookup(5), 50);
 }
+
+
+// 按权重限制容量：每个条目的权重为值的长度
+class WeightedCacheTest : public LRUCacheTest {
+protected:
+    void SetUp() override {
+        LRUCacheTest::SetUp();
+        LRUCacheOptions<std::string, std::string> options;
+        options.weigher = [](const std::string&, const std::string& value) {
+            return value.size();
+        };
+        cache = std::make_unique<LRUCache<std::string, std::string>>(20, [this](const std::string& key) {
+            loads.fetch_add(1);
+            return std::string(std::stoul(key), 'x');
+        }, options);
+    }
+
+    std::unique_ptr<LRUCache<std::string, std::string>> cache;
+};
+
+// 当前权重是所有条目权重之和
+TEST_F(WeightedCacheTest, TracksWeight) {
+    cache->CacheLookup("5");
+    cache->CacheLookup("8");
+    EXPECT_EQ(cache->Size(), 2);
+    EXPECT_EQ(cache->CurrentWeight(), 13);
+}
+
+// 淘汰持续进行，直到新条目能放下
+TEST_F(WeightedCacheTest, EvictsUntilFits) {
+    cache->CacheLookup("5");
+    cache->CacheLookup("6");
+    cache->CacheLookup("7"); // 总权重 18
+
+    // 权重 12：需要淘汰 5 和 6 两个条目
+    cache->CacheLookup("12");
+    EXPECT_EQ(cache->Size(), 2);
+    EXPECT_EQ(cache->CurrentWeight(), 19);
+
+    loads = 0;
+    cache->CacheLookup("7");
+    cache->CacheLookup("12");
+    EXPECT_EQ(loads, 0);
+}
+
+// 超过总容量的条目不放入缓存
+TEST_F(WeightedCacheTest, RejectsOversize) {
+    cache->CacheLookup("5");
+
+    std::string big = cache->CacheLookup("21");
+    EXPECT_EQ(big.size(), 21);
+    EXPECT_EQ(cache->Size(), 1);
+    EXPECT_EQ(cache->CurrentWeight(), 5);
+
+    // 没有缓存，再次访问仍然访问数据源
+    loads = 0;
+    cache->CacheLookup("21");
+    EXPECT_EQ(loads, 1);
+}
+
+// 未设置 weigher 时每个条目权重为 1
+TEST_F(LRUCacheTest, DefaultWeightIsOne) {
+    LRUCache<int, int> cache(3, slowDataSource);
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    EXPECT_EQ(cache.CurrentWeight(), 2);
+    EXPECT_EQ(cache.Size(), 2);
+}
+
+// 过期测试：时间由测试手动推进
+class ExpiringCacheTest : public LRUCacheTest {
+protected:
+    using Clock = std::chrono::steady_clock;
+
+    void SetUp() override {
+        LRUCacheTest::SetUp();
+        options.now = [this]() { return now; };
+    }
+
+    Clock::time_point now{};
+    LRUCacheOptions<int, int> options;
+};
+
+// 写入后超过存活时间的条目在访问时重新加载
+TEST_F(ExpiringCacheTest, ExpireAfterWrite) {
+    options.expire_after_write = std::chrono::seconds(10);
+    LRUCache<int, int> cache(3, CountingSource(), options);
+
+    cache.CacheLookup(1);
+    now += std::chrono::seconds(9);
+    cache.CacheLookup(1);
+    EXPECT_EQ(loads, 1);
+
+    // 命中不会延长写入后的存活时间
+    now += std::chrono::seconds(1);
+    EXPECT_EQ(cache.CacheLookup(1), 10);
+    EXPECT_EQ(loads, 2);
+    EXPECT_EQ(cache.Size(), 1);
+}
+
+// 每次命中重新计时
+TEST_F(ExpiringCacheTest, ExpireAfterAccess) {
+    options.expire_after_access = std::chrono::seconds(5);
+    LRUCache<int, int> cache(3, CountingSource(), options);
+
+    cache.CacheLookup(1);
+    for (int i = 0; i < 4; ++i) {
+        now += std::chrono::seconds(4);
+        cache.CacheLookup(1);
+    }
+    EXPECT_EQ(loads, 1);
+
+    now += std::chrono::seconds(5);
+    cache.CacheLookup(1);
+    EXPECT_EQ(loads, 2);
+}
+
+// 访问续期不超过写入时的期限
+TEST_F(ExpiringCacheTest, AccessBoundedByWrite) {
+    options.expire_after_write = std::chrono::seconds(6);
+    options.expire_after_access = std::chrono::seconds(4);
+    LRUCache<int, int> cache(3, CountingSource(), options);
+
+    cache.CacheLookup(1);
+    now += std::chrono::seconds(3);
+    cache.CacheLookup(1);
+    now += std::chrono::seconds(3);
+    cache.CacheLookup(1);
+    EXPECT_EQ(loads, 2);
+}
+
+// 按条目计算的存活时间取代默认值
+TEST_F(ExpiringCacheTest, PerEntryExpiry) {
+    options.expire_after_write = std::chrono::seconds(100);
+    options.expiry = [](const int& key, const int&) -> Clock::duration {
+        if (key == 1)
+            return std::chrono::seconds(1);
+        return Clock::duration::max();
+    };
+    LRUCache<int, int> cache(3, CountingSource(), options);
+
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    now += std::chrono::hours(24);
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    EXPECT_EQ(loads, 3);
+}
+
+// Cleanup 回收过期条目，未过期和永不过期的条目保留
+TEST_F(ExpiringCacheTest, CleanupReclaims) {
+    options.timer_tick = std::chrono::milliseconds(100);
+    options.expiry = [](const int& key, const int&) -> Clock::duration {
+        if (key == 3)
+            return Clock::duration::max();
+        return std::chrono::seconds(key);
+    };
+    LRUCache<int, int> cache(4, CountingSource(), options);
+
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    cache.CacheLookup(3);
+    EXPECT_EQ(cache.Cleanup(), 0);
+
+    now += std::chrono::milliseconds(1500);
+    EXPECT_EQ(cache.Cleanup(), 1);
+    EXPECT_EQ(cache.Size(), 2);
+    EXPECT_EQ(cache.CurrentWeight(), 2);
+
+    now += std::chrono::hours(1);
+    EXPECT_EQ(cache.Cleanup(), 1);
+    EXPECT_EQ(cache.Size(), 1);
+
+    // 回收后再次访问重新加载
+    cache.CacheLookup(1);
+    EXPECT_EQ(loads, 4);
+    cache.CacheLookup(3);
+    EXPECT_EQ(loads, 4);
+}
+
+// 被容量淘汰的条目同时释放定时器，之后的 Cleanup 不受影响
+TEST_F(ExpiringCacheTest, EvictionCancelsTimer) {
+    options.expire_after_write = std::chrono::seconds(1);
+    LRUCache<int, int> cache(2, CountingSource(), options);
+
+    for (int key = 1; key <= 5; ++key)
+        cache.CacheLookup(key);
+    EXPECT_EQ(cache.Size(), 2);
+
+    now += std::chrono::seconds(2);
+    EXPECT_EQ(cache.Cleanup(), 2);
+    EXPECT_EQ(cache.Size(), 0);
+    EXPECT_EQ(cache.CurrentWeight(), 0);
+}
+
+// 同时设置 weigher 与过期时间：过期回收和容量淘汰都按条目的权重扣减
+TEST_F(ExpiringCacheTest, WeightedExpiry) {
+    options.weigher = [](const int& key, const int&) { return static_cast<size_t>(key); };
+    options.expiry = [](const int& key, const int&) -> Clock::duration {
+        if (key == 2)
+            return std::chrono::seconds(1);
+        return Clock::duration::max();
+    };
+    LRUCache<int, int> cache(6, CountingSource(), options);
+
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    cache.CacheLookup(3);
+    EXPECT_EQ(cache.CurrentWeight(), 6);
+
+    now += std::chrono::seconds(2);
+    EXPECT_EQ(cache.Cleanup(), 1);
+    EXPECT_EQ(cache.CurrentWeight(), 4);
+
+    // 放入权重为 4 的键需要淘汰键1和键3
+    cache.CacheLookup(4);
+    EXPECT_EQ(cache.Size(), 1);
+    EXPECT_EQ(cache.CurrentWeight(), 4);
+}
+
+// on_evict 只在容量淘汰时调用，过期移除不调用
+TEST_F(ExpiringCacheTest, OnEvictSkipsExpired) {
+    std::vector<std::pair<int, int>> evicted;
+    options.expiry = [](const int& key, const int&) -> Clock::duration {
+        if (key == 2)
+            return std::chrono::seconds(1);
+        return Clock::duration::max();
+    };
+    options.on_evict = [&evicted](const int& key, const int& value) {
+        evicted.emplace_back(key, value);
+    };
+    LRUCache<int, int> cache(2, CountingSource(), options);
+
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    cache.CacheLookup(3);
+    EXPECT_EQ(evicted, (std::vector<std::pair<int, int>>{{1, 10}}));
+
+    now += std::chrono::seconds(2);
+    EXPECT_EQ(cache.Cleanup(), 1);
+    cache.CacheLookup(4);
+    cache.CacheLookup(5);
+    EXPECT_EQ(evicted, (std::vector<std::pair<int, int>>{{1, 10}, {3, 30}}));
+}
+
+// 被选为受害者时已经过期（尚未被 Cleanup 回收）的条目同样不调用 on_evict
+TEST_F(ExpiringCacheTest, OnEvictSkipsExpiredVictim) {
+    std::vector<int> evicted;
+    options.expire_after_write = std::chrono::seconds(1);
+    options.on_evict = [&evicted](const int& key, const int&) { evicted.push_back(key); };
+    LRUCache<int, int> cache(1, CountingSource(), options);
+
+    cache.CacheLookup(1);
+    now += std::chrono::seconds(2);
+    cache.CacheLookup(2);
+    cache.CacheLookup(3);
+    EXPECT_EQ(evicted, (std::vector<int>{2}));
+}
+
+// 批量查找测试
+class BatchLookupTest : public LRUCacheTest {
+protected:
+    void SetUp() override {
+        LRUCacheTest::SetUp();
+        options.bulk_source = [this](std::span<const int> keys) {
+            batches.emplace_back(keys.begin(), keys.end());
+            std::vector<int> values;
+            for (int key : keys)
+                values.push_back(key * 10);
+            return values;
+        };
+    }
+
+    // 每次调用 bulk_source 时传入的键
+    std::vector<std::vector<int>> batches;
+    LRUCacheOptions<int, int> options;
+};
+
+// 命中直接返回，所有未命中的键只调用一次 bulk_source
+TEST_F(BatchLookupTest, OneBulkCallForMisses) {
+    LRUCache<int, int> cache(10, CountingSource(), options);
+    cache.CacheLookup(2);
+
+    std::vector<int> keys = {1, 2, 3, 1, 4};
+    std::vector<int> values = cache.CacheLookupMany(keys);
+
+    EXPECT_EQ(values, (std::vector<int>{10, 20, 30, 10, 40}));
+    ASSERT_EQ(batches.size(), 1);
+    EXPECT_EQ(batches[0], (std::vector<int>{1, 3, 4}));
+    EXPECT_EQ(cache.Size(), 4);
+
+    // 全部命中时不访问数据源
+    cache.CacheLookupMany(keys);
+    EXPECT_EQ(batches.size(), 1);
+    EXPECT_EQ(loads, 1);
+}
+
+// 没有 bulk_source 时逐个调用 data_source
+TEST_F(BatchLookupTest, FallsBackToDataSource) {
+    LRUCache<int, int> cache(10, CountingSource());
+
+    std::vector<int> keys = {5, 6, 5};
+    EXPECT_EQ(cache.CacheLookupMany(keys), (std::vector<int>{50, 60, 50}));
+    EXPECT_EQ(loads, 2);
+}
+
+// 批次超过容量时保留靠后的键
+TEST_F(BatchLookupTest, KeepsLatestWhenOverCapacity) {
+    LRUCache<int, int> cache(3, CountingSource(), options);
+    cache.CacheLookup(100);
+
+    std::vector<int> keys = {1, 2, 3, 4, 5};
+    EXPECT_EQ(cache.CacheLookupMany(keys), (std::vector<int>{10, 20, 30, 40, 50}));
+    EXPECT_EQ(cache.Size(), 3);
+
+    loads = 0;
+    cache.CacheLookup(3);
+    cache.CacheLookup(4);
+    cache.CacheLookup(5);
+    EXPECT_EQ(loads, 0);
+    cache.CacheLookup(100);
+    EXPECT_EQ(loads, 1);
+}
+
+// 批量插入后淘汰顺序与逐个查找一致
+TEST_F(BatchLookupTest, EvictsOncePreservingOrder) {
+    LRUCache<int, int> cache(4, CountingSource(), options);
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    cache.CacheLookup(3);
+
+    // 1 被命中，需要淘汰两个条目：2 和 3
+    std::vector<int> keys = {1, 7, 8};
+    cache.CacheLookupMany(keys);
+    EXPECT_EQ(cache.Size(), 4);
+
+    loads = 0;
+    cache.CacheLookup(1);
+    cache.CacheLookup(7);
+    cache.CacheLookup(8);
+    EXPECT_EQ(loads, 0);
+}
+
+// 记录钩子调用顺序的 LRU 策略
+struct RecordingPolicy : LRUPolicy<int> {
+    static inline std::vector<std::string> events;
+
+    explicit RecordingPolicy(size_t capacity) : LRUPolicy<int>(capacity) {}
+
+    void OnMiss(const int& key) { events.push_back("miss " + std::to_string(key)); }
+
+    std::optional<int> Victim() {
+        std::optional<int> key = LRUPolicy<int>::Victim();
+        if (key.has_value())
+            events.push_back("evict " + std::to_string(key.value()));
+        return key;
+    }
+};
+
+// 每个未命中的键（包括放不下的）都在淘汰之前通知策略
+TEST_F(BatchLookupTest, OnMissBeforeEviction) {
+    LRUCache<int, int, RecordingPolicy> cache(2, CountingSource(), options);
+    cache.CacheLookup(100);
+    RecordingPolicy::events.clear();
+
+    std::vector<int> keys = {1, 100, 2, 3};
+    cache.CacheLookupMany(keys);
+    EXPECT_EQ(RecordingPolicy::events, (std::vector<std::string>{"miss 1", "miss 2", "miss 3", "evict 100"}));
+}
+
+// bulk_source 的异常传给调用方，且不缓存任何结果
+TEST_F(BatchLookupTest, ErrorsPropagate) {
+    options.bulk_source = [](std::span<const int>) -> std::vector<int> {
+        throw std::runtime_error("backend unavailable");
+    };
+    LRUCache<int, int> cache(4, CountingSource(), options);
+
+    std::vector<int> keys = {1, 2};
+    EXPECT_THROW(cache.CacheLookupMany(keys), std::runtime_error);
+    EXPECT_EQ(cache.Size(), 0);
+
+    // 返回值个数与键不一致
+    options.bulk_source = [](std::span<const int>) { return std::vector<int>{1}; };
+    LRUCache<int, int> short_cache(4, CountingSource(), options);
+    EXPECT_THROW(short_cache.CacheLookupMany(keys), std::length_error);
+    EXPECT_EQ(short_cache.Size(), 0);
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include "../include/LRU/LRUCache.hpp"
+#include "../include/Simulator/MissRatioCurve.hpp"
+#include "../include/Simulator/TraceReader.hpp"
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+
+class MissRatioCurveTest : public ::testing::Test {
+protected:
+    // 偏斜的随机轨迹：小的键被访问得更频繁
+    static std::vector<uint64_t> SkewedTrace(size_t key_space, size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        std::vector<uint64_t> trace(count);
+        for (auto &key: trace)
+            key = static_cast<uint64_t>(std::pow(dist(rng), 3.0) * static_cast<double>(key_space));
+        return trace;
+    }
+
+    // 直接用 LRUCache 回放得到的未命中率
+    static double SimulatedMissRatio(const std::vector<uint64_t> &trace, size_t size) {
+        uint64_t misses = 0;
+        LRUCache<uint64_t, uint64_t> cache(size, [&misses](const uint64_t &key) {
+            misses = misses + 1;
+            return key;
+        });
+        for (uint64_t key: trace)
+            cache.CacheLookup(key);
+        return static_cast<double>(misses) / static_cast<double>(trace.size());
+    }
+};
+
+// 手工可验证的小例子
+TEST_F(MissRatioCurveTest, StackDistances) {
+    MissRatioCurve curve;
+    for (uint64_t key: {1, 2, 3, 1, 2, 3, 3})
+        curve.Access(key);
+
+    // 3 次冷启动未命中；1、2、3 的重访栈距离为 2，最后一次 3 的栈距离为 0
+    EXPECT_DOUBLE_EQ(curve.MissRatio(1), 6.0 / 7.0);
+    EXPECT_DOUBLE_EQ(curve.MissRatio(2), 6.0 / 7.0);
+    EXPECT_DOUBLE_EQ(curve.MissRatio(3), 3.0 / 7.0);
+    EXPECT_DOUBLE_EQ(curve.MissRatio(100), 3.0 / 7.0);
+    EXPECT_DOUBLE_EQ(curve.MissRatio(0), 1.0);
+    EXPECT_EQ(curve.DistinctKeys(), 3);
+}
+
+// 不采样时与逐个容量回放 LRUCache 的结果完全一致（轨迹足够长，会触发时间点压缩）
+TEST_F(MissRatioCurveTest, MatchesLRUCacheExactly) {
+    auto trace = SkewedTrace(5000, 200000, 1);
+    MissRatioCurve curve;
+    for (uint64_t key: trace)
+        curve.Access(key);
+
+    for (size_t size: {1, 10, 100, 500, 1000, 4000, 10000})
+        EXPECT_DOUBLE_EQ(curve.MissRatio(size), SimulatedMissRatio(trace, size)) << size;
+}
+
+// 未命中率随容量单调不增
+TEST_F(MissRatioCurveTest, Monotonic) {
+    auto trace = SkewedTrace(2000, 50000, 2);
+    MissRatioCurve curve;
+    for (uint64_t key: trace)
+        curve.Access(key);
+
+    double previous = 1.0;
+    for (size_t size = 1; size <= 2000; size += 37) {
+        double ratio = curve.MissRatio(size);
+        EXPECT_LE(ratio, previous + 1e-12);
+        previous = ratio;
+    }
+}
+
+// SHARDS 采样的结果接近精确值
+TEST_F(MissRatioCurveTest, SampledApproximatesExact) {
+    auto trace = SkewedTrace(200000, 400000, 3);
+    MissRatioCurve exact;
+    MissRatioCurve sampled(0.1);
+    for (uint64_t key: trace) {
+        exact.Access(key);
+        sampled.Access(key);
+    }
+
+    EXPECT_EQ(sampled.Accesses(), trace.size());
+    EXPECT_LT(sampled.SampledAccesses(), trace.size() / 5);
+
+    for (size_t size: {1000, 5000, 20000, 50000, 100000})
+        EXPECT_NEAR(sampled.MissRatio(size), exact.MissRatio(size), 0.03) << size;
+}
+
+// 轨迹文件的流式读取
+class TraceReaderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path = std::filesystem::temp_directory_path() /
+               ("cache_trace_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + "_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name());
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    std::filesystem::path path;
+};
+
+// 文本格式：整数直接作为键，其余内容取哈希，忽略空行与注释
+TEST_F(TraceReaderTest, Text) {
+    {
+        std::ofstream out(path);
+        out << "# comment\n1\n\n42\r\nuser:7\nuser:7\n18446744073709551615\n";
+    }
+
+    TraceReader reader(path.string(), TraceFormat::Text);
+    ASSERT_TRUE(reader.IsOpen());
+
+    std::vector<uint64_t> keys;
+    uint64_t key = 0;
+    while (reader.Next(key))
+        keys.push_back(key);
+
+    ASSERT_EQ(keys.size(), 5);
+    EXPECT_EQ(keys[0], 1);
+    EXPECT_EQ(keys[1], 42);
+    EXPECT_EQ(keys[2], keys[3]);
+    EXPECT_NE(keys[2], 7);
+    EXPECT_EQ(keys[4], UINT64_MAX);
+    EXPECT_EQ(reader.Count(), 5);
+}
+
+// 二进制格式：8 字节小端整数，末尾不完整的记录被忽略
+TEST_F(TraceReaderTest, Binary) {
+    {
+        std::ofstream out(path, std::ios::binary);
+        const unsigned char bytes[] = {
+            0x01, 0, 0, 0, 0, 0, 0, 0,
+            0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01,
+            0xff, 0xff
+        };
+        out.write(reinterpret_cast<const char *>(bytes), sizeof(bytes));
+    }
+
+    TraceReader reader(path.string(), TraceFormat::Binary);
+    uint64_t key = 0;
+    ASSERT_TRUE(reader.Next(key));
+    EXPECT_EQ(key, 1);
+    ASSERT_TRUE(reader.Next(key));
+    EXPECT_EQ(key, 0x0102030405060708ULL);
+    EXPECT_FALSE(reader.Next(key));
+}
+
+// 文件不存在
+TEST_F(TraceReaderTest, MissingFile) {
+    TraceReader reader((path / "missing").string(), TraceFormat::Text);
+    EXPECT_FALSE(reader.IsOpen());
+    uint64_t key = 0;
+    EXPECT_FALSE(reader.Next(key));
+}
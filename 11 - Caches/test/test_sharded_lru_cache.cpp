@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+#include "../include/LRU/ShardedLRUCache.hpp"
+#include "LRUCacheTest.hpp"
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ShardedLRUCacheTest : public LRUCacheTest {};
+
+// 基本操作测试
+TEST_F(ShardedLRUCacheTest, BasicLookup) {
+    ShardedLRUCache<int, int> cache(64, CountingSource(), 4);
+    EXPECT_EQ(cache.ShardCount(), 4);
+
+    EXPECT_EQ(cache.CacheLookup(1), 10);
+    EXPECT_EQ(cache.CacheLookup(1), 10);
+    EXPECT_EQ(loads.load(), 1);
+    EXPECT_EQ(cache.Size(), 1);
+}
+
+// 分片数向上取整为 2 的幂
+TEST_F(ShardedLRUCacheTest, ShardCountRoundsUp) {
+    ShardedLRUCache<int, int> cache(64, CountingSource(), 5);
+    EXPECT_EQ(cache.ShardCount(), 8);
+}
+
+// 容量小于分片数时减少分片，总容量不超过 max_sz
+TEST_F(ShardedLRUCacheTest, ShardCountClampedToCapacity) {
+    ShardedLRUCache<int, int> cache(3, CountingSource());
+    EXPECT_EQ(cache.ShardCount(), 2);
+    for (int i = 0; i < 1000; ++i)
+        cache.CacheLookup(i);
+    EXPECT_EQ(cache.Size(), 3);
+}
+
+// 不能整除时余数分给部分分片，填满后条目数恰好等于 max_sz
+TEST_F(ShardedLRUCacheTest, CapacityExactWithRemainder) {
+    ShardedLRUCache<int, int> cache(100, CountingSource(), 16);
+    for (int i = 0; i < 10000; ++i)
+        cache.CacheLookup(i);
+    EXPECT_EQ(cache.Size(), 100);
+}
+
+// 单分片时行为与普通 LRU 一致
+TEST_F(ShardedLRUCacheTest, SingleShardLRUOrder) {
+    ShardedLRUCache<int, int> cache(3, CountingSource(), 1);
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    cache.CacheLookup(3);
+    cache.CacheLookup(1); // 队列: [2, 3, 1]
+    cache.CacheLookup(4); // 键2被移除
+
+    loads = 0;
+    cache.CacheLookup(3);
+    cache.CacheLookup(1);
+    cache.CacheLookup(4);
+    EXPECT_EQ(loads.load(), 0);
+    cache.CacheLookup(2);
+    EXPECT_EQ(loads.load(), 1);
+}
+
+// 总条目数不超过各分片容量之和
+TEST_F(ShardedLRUCacheTest, CapacityBound) {
+    ShardedLRUCache<int, int> cache(100, CountingSource(), 4);
+    for (int i = 0; i < 1000; ++i)
+        cache.CacheLookup(i);
+    EXPECT_LE(cache.Size(), 100);
+    EXPECT_GT(cache.Size(), 50);
+}
+
+// 数据源在锁外调用，可以重入缓存而不会死锁
+TEST_F(ShardedLRUCacheTest, ReentrantDataSource) {
+    std::unique_ptr<ShardedLRUCache<int, int>> cache;
+    cache = std::make_unique<ShardedLRUCache<int, int>>(16, [&cache](const int &key) {
+        return key == 0 ? 0 : cache->CacheLookup(key - 1) + 1;
+    }, 1);
+    EXPECT_EQ(cache->CacheLookup(5), 5);
+    EXPECT_EQ(cache->Size(), 6);
+}
+
+// 多线程并发访问结果正确
+TEST_F(ShardedLRUCacheTest, ConcurrentLookups) {
+    ShardedLRUCache<int, int> cache(256, CountingSource(), 8);
+    const int num_threads = 4;
+    std::atomic<int> errors{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < 20000; ++i) {
+                int key = (i * 7 + t) % 512;
+                if (cache.CacheLookup(key) != key * 10)
+                    errors.fetch_add(1);
+            }
+        });
+    }
+    for (auto &thread: threads)
+        thread.join();
+
+    EXPECT_EQ(errors.load(), 0);
+    EXPECT_LE(cache.Size(), 256);
+}
+
+// 并发未命中同一个键时只访问一次数据源
+TEST_F(ShardedLRUCacheTest, CoalescesConcurrentMisses) {
+    const int num_threads = 8;
+    std::atomic<int> arrived{0};
+
+    ShardedLRUCache<int, int> cache(16, [&](const int &key) {
+        loads.fetch_add(1);
+        // 等所有线程都发起查找后再返回，让它们有机会等待同一个占位
+        while (arrived.load() < num_threads)
+            std::this_thread::yield();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return key * 10;
+    }, 4);
+
+    std::vector<int> results(num_threads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            arrived.fetch_add(1);
+            results[t] = cache.CacheLookup(7);
+        });
+    }
+    for (auto &thread: threads)
+        thread.join();
+
+    EXPECT_EQ(loads.load(), 1);
+    for (int result: results)
+        EXPECT_EQ(result, 70);
+}
+
+// 数据源抛出的异常传递给所有等待者，且不会被缓存
+TEST_F(ShardedLRUCacheTest, ErrorsPropagateAndAreNotCached) {
+    const int num_threads = 4;
+    std::atomic<int> arrived{0};
+    std::atomic<bool> fail{true};
+
+    ShardedLRUCache<int, int> cache(16, [&](const int &key) {
+        loads.fetch_add(1);
+        if (!fail.load())
+            return key * 10;
+        while (arrived.load() < num_threads)
+            std::this_thread::yield();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        throw std::runtime_error("backend unavailable");
+    }, 4);
+
+    std::atomic<int> errors{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&]() {
+            arrived.fetch_add(1);
+            try {
+                cache.CacheLookup(3);
+            } catch (const std::runtime_error &) {
+                errors.fetch_add(1);
+            }
+        });
+    }
+    for (auto &thread: threads)
+        thread.join();
+
+    EXPECT_EQ(errors.load(), num_threads);
+    EXPECT_EQ(loads.load(), 1);
+    EXPECT_EQ(cache.Size(), 0);
+
+    // 失败没有被缓存，下一次查找重新访问数据源
+    fail = false;
+    EXPECT_EQ(cache.CacheLookup(3), 30);
+    EXPECT_EQ(loads.load(), 2);
+}
+
+// 字符串类型缓存测试
+TEST_F(ShardedLRUCacheTest, StringCache) {
+    ShardedLRUCache<std::string, std::string> cache(8, [](const std::string &key) {
+        return "value_" + key;
+    });
+    EXPECT_EQ(cache.CacheLookup("key1"), "value_key1");
+    EXPECT_EQ(cache.CacheLookup("key1"), "value_key1");
+    EXPECT_EQ(cache.Size(), 1);
+}
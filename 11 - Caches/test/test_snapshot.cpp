@@ -0,0 +1,294 @@
+#include <gtest/gtest.h>
+#include "../include/LRU/LRUCache.hpp"
+#include "../include/Policy/SLRUPolicy.hpp"
+#include "../include/Policy/ARCPolicy.hpp"
+#include "../include/Snapshot/Snapshot.hpp"
+#include "LRUCacheTest.hpp"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 自定义类型通过特化 Serializer 接入
+struct Point {
+    int x = 0;
+    int y = 0;
+};
+
+template<>
+struct Serializer<Point> {
+    static void Write(SnapshotWriter &out, const Point &p) {
+        Serializer<int>::Write(out, p.x);
+        Serializer<int>::Write(out, p.y);
+    }
+
+    static bool Read(SnapshotReader &in, Point &p) {
+        return Serializer<int>::Read(in, p.x) && Serializer<int>::Read(in, p.y);
+    }
+};
+
+class SnapshotTest : public LRUCacheTest {
+protected:
+    void SetUp() override {
+        LRUCacheTest::SetUp();
+        path = (std::filesystem::temp_directory_path() /
+                (std::string("cache_snapshot_") + ::testing::UnitTest::GetInstance()->current_test_info()->name()))
+                .string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + ".tmp");
+    }
+
+    // 修改文件中的一个字节
+    void CorruptByte(std::streamoff offset) {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(offset);
+        char byte = 0;
+        file.read(&byte, 1);
+        byte = static_cast<char>(byte ^ 0x5a);
+        file.seekp(offset);
+        file.write(&byte, 1);
+    }
+
+    std::string path;
+};
+
+// 保存后加载到新缓存：内容与 LRU 顺序都被还原
+TEST_F(SnapshotTest, RestoresRecencyOrder) {
+    LRUCache<int, int> cache(4, CountingSource());
+    for (int key: {1, 2, 3, 4, 1, 3})
+        cache.CacheLookup(key);
+    ASSERT_TRUE(cache.SaveSnapshot(path));
+
+    LRUCache<int, int> restored(4, CountingSource());
+    ASSERT_TRUE(restored.LoadSnapshot(path));
+    EXPECT_EQ(restored.Size(), 4);
+    EXPECT_EQ(restored.Entries(), cache.Entries());
+
+    // 访问顺序为 2、4、1、3，新键应依次淘汰 2 和 4
+    loads = 0;
+    restored.CacheLookup(5);
+    restored.CacheLookup(6);
+    restored.CacheLookup(1);
+    restored.CacheLookup(3);
+    EXPECT_EQ(loads, 2);
+    restored.CacheLookup(2);
+    EXPECT_EQ(loads, 3);
+}
+
+// SLRU、ARC 按 ForEach 的顺序（最先淘汰的在前）保存，加载后淘汰顺序不变
+TEST_F(SnapshotTest, PolicyRoundTrip) {
+    LRUCache<int, int, SLRUPolicy<int>> slru(4, CountingSource());
+    LRUCache<int, int, ARCPolicy<int>> arc(4, CountingSource());
+    for (int key: {1, 2, 3, 1, 4, 5, 3}) {
+        slru.CacheLookup(key);
+        arc.CacheLookup(key);
+    }
+
+    ASSERT_TRUE(slru.SaveSnapshot(path));
+    LRUCache<int, int, SLRUPolicy<int>> slru_restored(4, CountingSource());
+    ASSERT_TRUE(slru_restored.LoadSnapshot(path));
+    EXPECT_EQ(slru_restored.Entries(), slru.Entries());
+    EXPECT_EQ(slru_restored.Entries(), (SnapshotEntries<int, int>{{4, 40}, {5, 50}, {1, 10}, {3, 30}}));
+
+    ASSERT_TRUE(arc.SaveSnapshot(path));
+    LRUCache<int, int, ARCPolicy<int>> arc_restored(4, CountingSource());
+    ASSERT_TRUE(arc_restored.LoadSnapshot(path));
+    EXPECT_EQ(arc_restored.Entries(), arc.Entries());
+
+    // 试用段（T1）中的键最先淘汰
+    loads = 0;
+    slru_restored.CacheLookup(6);
+    arc_restored.CacheLookup(6);
+    slru_restored.CacheLookup(3);
+    arc_restored.CacheLookup(3);
+    EXPECT_EQ(loads, 2);
+}
+
+// 未命中后没有插入（数据源抛出异常）时加载快照：ARC 的幽灵状态随策略一起重建
+TEST_F(SnapshotTest, ARCLoadAfterFailedMiss) {
+    bool fail = false;
+    LRUCache<int, int, ARCPolicy<int>> cache(2, [&fail](const int &key) {
+        if (fail)
+            throw std::runtime_error("source unavailable");
+        return key * 10;
+    });
+    for (int key: {1, 1, 2, 3})
+        cache.CacheLookup(key);
+    ASSERT_TRUE(cache.SaveSnapshot(path));
+
+    fail = true;
+    EXPECT_THROW(cache.CacheLookup(2), std::runtime_error);
+    fail = false;
+
+    ASSERT_TRUE(cache.LoadSnapshot(path));
+    EXPECT_EQ(cache.Entries(), (SnapshotEntries<int, int>{{3, 30}, {1, 10}}));
+
+    // 之后的行为与刚加载同一快照的新缓存完全一致
+    LRUCache<int, int, ARCPolicy<int>> fresh(2, CountingSource());
+    ASSERT_TRUE(fresh.LoadSnapshot(path));
+    for (int key: {2, 4, 2, 1, 5, 4}) {
+        EXPECT_EQ(cache.CacheLookup(key), key * 10);
+        fresh.CacheLookup(key);
+        EXPECT_EQ(cache.Entries(), fresh.Entries()) << key;
+    }
+}
+
+// 字符串键值
+TEST_F(SnapshotTest, Strings) {
+    LRUCache<std::string, std::string> cache(8, [](const std::string &key) {
+        return std::string(1000, key[0]);
+    });
+    cache.CacheLookup("a");
+    cache.CacheLookup("");
+    cache.CacheLookup("bc");
+    ASSERT_TRUE(cache.SaveSnapshot(path));
+
+    LRUCache<std::string, std::string> restored(8, [](const std::string &) { return std::string(); });
+    ASSERT_TRUE(restored.LoadSnapshot(path));
+    EXPECT_EQ(restored.Entries(), cache.Entries());
+    EXPECT_EQ(restored.CacheLookup("bc"), std::string(1000, 'b'));
+}
+
+// 自定义序列化器
+TEST_F(SnapshotTest, CustomSerializer) {
+    LRUCache<int, Point> cache(4, [](const int &key) { return Point{key, -key}; });
+    cache.CacheLookup(7);
+    ASSERT_TRUE(cache.SaveSnapshot(path));
+
+    LRUCache<int, Point> restored(4, [](const int &) { return Point{}; });
+    ASSERT_TRUE(restored.LoadSnapshot(path));
+    Point p = restored.CacheLookup(7);
+    EXPECT_EQ(p.x, 7);
+    EXPECT_EQ(p.y, -7);
+}
+
+// 容量变小时保留最后淘汰的条目
+TEST_F(SnapshotTest, SmallerCapacityKeepsMostRecent) {
+    LRUCache<int, int> cache(5, CountingSource());
+    for (int key = 1; key <= 5; ++key)
+        cache.CacheLookup(key);
+    ASSERT_TRUE(cache.SaveSnapshot(path));
+
+    LRUCache<int, int> restored(2, CountingSource());
+    ASSERT_TRUE(restored.LoadSnapshot(path));
+    EXPECT_EQ(restored.Entries(), (SnapshotEntries<int, int>{{4, 40}, {5, 50}}));
+}
+
+// 损坏、截断、版本不符的快照被拒绝，缓存保持不变
+TEST_F(SnapshotTest, RejectsCorruptSnapshots) {
+    LRUCache<int, int> cache(4, CountingSource());
+    for (int key = 1; key <= 4; ++key)
+        cache.CacheLookup(key);
+    ASSERT_TRUE(cache.SaveSnapshot(path));
+    auto size = static_cast<std::streamoff>(std::filesystem::file_size(path));
+
+    LRUCache<int, int> target(4, CountingSource());
+    target.CacheLookup(100);
+    auto before = target.Entries();
+
+    // 条目内容损坏：校验和不符
+    CorruptByte(size - 3);
+    EXPECT_FALSE(target.LoadSnapshot(path));
+    EXPECT_EQ(target.Entries(), before);
+    CorruptByte(size - 3);
+    LRUCache<int, int> intact(4, CountingSource());
+    EXPECT_TRUE(intact.LoadSnapshot(path));
+
+    // 版本号
+    CorruptByte(8);
+    EXPECT_FALSE(target.LoadSnapshot(path));
+    CorruptByte(8);
+
+    // 条目数
+    CorruptByte(12);
+    EXPECT_FALSE(target.LoadSnapshot(path));
+    CorruptByte(12);
+
+    // 魔数
+    CorruptByte(0);
+    EXPECT_FALSE(target.LoadSnapshot(path));
+    CorruptByte(0);
+
+    // 截断
+    std::filesystem::resize_file(path, static_cast<uintmax_t>(size - 1));
+    EXPECT_FALSE(target.LoadSnapshot(path));
+    EXPECT_EQ(target.Entries(), before);
+
+    // 不存在
+    EXPECT_FALSE(target.LoadSnapshot(path + ".missing"));
+}
+
+// 条目数被改成不超过文件大小的大值：按文件大小限制预留的内存，读到文件末尾后拒绝
+TEST_F(SnapshotTest, RejectsInflatedCount) {
+    SnapshotEntries<std::string, std::string> entries = {{"a", std::string(4096, 'x')}, {"b", "y"}};
+    ASSERT_TRUE(WriteSnapshot(path, entries));
+
+    uint64_t count = std::filesystem::file_size(path);
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(12);
+        file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+    }
+
+    SnapshotEntries<std::string, std::string> loaded = {{"keep", "me"}};
+    EXPECT_FALSE(ReadSnapshot(path, loaded));
+    EXPECT_EQ(loaded.size(), 1u);
+}
+
+// 快照中的键值类型与读取方不一致：长度对不上，同样被拒绝
+TEST_F(SnapshotTest, RejectsTypeMismatch) {
+    LRUCache<int, int> cache(4, CountingSource());
+    cache.CacheLookup(1);
+    ASSERT_TRUE(cache.SaveSnapshot(path));
+
+    LRUCache<int64_t, int64_t> other(4, [](const int64_t &key) { return key; });
+    EXPECT_FALSE(other.LoadSnapshot(path));
+}
+
+// 复制条目后，写文件可以在后台线程中与查找同时进行
+TEST_F(SnapshotTest, BackgroundWrite) {
+    LRUCache<int, int> cache(1000, CountingSource());
+    for (int key = 0; key < 1000; ++key)
+        cache.CacheLookup(key);
+
+    SnapshotEntries<int, int> entries = cache.Entries();
+    bool written = false;
+    std::thread writer([&]() { written = WriteSnapshot(path, entries); });
+    for (int key = 1000; key < 1500; ++key)
+        cache.CacheLookup(key);
+    writer.join();
+    ASSERT_TRUE(written);
+
+    LRUCache<int, int> restored(1000, CountingSource());
+    ASSERT_TRUE(restored.LoadSnapshot(path));
+    EXPECT_EQ(restored.Entries(), entries);
+}
+
+// 已过期的条目不写入快照，加载后重新计算过期时间
+TEST_F(SnapshotTest, SkipsExpiredEntries) {
+    std::chrono::steady_clock::time_point now{};
+    LRUCacheOptions<int, int> options;
+    options.expiry = [](const int &key, const int &) -> std::chrono::steady_clock::duration {
+        return std::chrono::seconds(key);
+    };
+    options.now = [&now]() { return now; };
+
+    LRUCache<int, int> cache(4, CountingSource(), options);
+    cache.CacheLookup(1);
+    cache.CacheLookup(5);
+    now += std::chrono::seconds(2);
+    ASSERT_TRUE(cache.SaveSnapshot(path));
+
+    LRUCache<int, int> restored(4, CountingSource(), options);
+    ASSERT_TRUE(restored.LoadSnapshot(path));
+    EXPECT_EQ(restored.Entries(), (SnapshotEntries<int, int>{{5, 50}}));
+
+    now += std::chrono::seconds(5);
+    EXPECT_EQ(restored.Cleanup(), 1);
+}
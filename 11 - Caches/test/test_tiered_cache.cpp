@@ -0,0 +1,267 @@
+#include <gtest/gtest.h>
+#include "../include/Tiered/TieredCache.hpp"
+#include "LRUCacheTest.hpp"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// 每个测试使用独立的临时目录
+class TieredCacheTest : public LRUCacheTest {
+protected:
+    void SetUp() override {
+        LRUCacheTest::SetUp();
+        dir = std::filesystem::temp_directory_path() /
+              (std::string("tiered_cache_") + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::create_directories(dir);
+        path = (dir / "tier.log").string();
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(dir);
+    }
+
+    TieredCacheOptions<int, int> Options(size_t file_capacity = 1024 * 1024) {
+        TieredCacheOptions<int, int> options;
+        options.path = path;
+        options.file_capacity = file_capacity;
+        return options;
+    }
+
+    std::filesystem::path dir;
+    std::string path;
+};
+
+// 文件层：写入、覆盖、查找
+TEST_F(TieredCacheTest, FileTierPutGet) {
+    FileTier<int, std::string> tier(path, 4096);
+    ASSERT_TRUE(tier.IsOpen());
+
+    EXPECT_TRUE(tier.Put(1, "one"));
+    EXPECT_TRUE(tier.Put(2, "two"));
+    size_t live = tier.LiveBytes();
+    EXPECT_TRUE(tier.Put(1, "uno"));
+
+    EXPECT_EQ(tier.Get(1), "uno");
+    EXPECT_EQ(tier.Get(2), "two");
+    EXPECT_FALSE(tier.Get(3).has_value());
+    EXPECT_EQ(tier.Size(), 2);
+    EXPECT_EQ(tier.LiveBytes(), live);
+}
+
+// 日志写满时压缩：丢弃最早写入的记录，文件大小不变
+TEST_F(TieredCacheTest, FileTierCompactsOldest) {
+    FileTier<int, int> tier(path, 4096);
+    for (int key = 0; key < 1000; ++key)
+        ASSERT_TRUE(tier.Put(key, key * 10));
+
+    EXPECT_GT(tier.Compactions(), 0);
+    EXPECT_GT(tier.Dropped(), 0);
+    EXPECT_LE(tier.LiveBytes(), tier.Capacity());
+    EXPECT_EQ(tier.Size() + tier.Dropped(), 1000);
+    EXPECT_EQ(std::filesystem::file_size(path), 4096);
+
+    // 保留的是最近写入的键
+    for (int key = 1000 - static_cast<int>(tier.Size()); key < 1000; ++key)
+        ASSERT_EQ(tier.Get(key), key * 10) << key;
+    EXPECT_FALSE(tier.Get(0).has_value());
+}
+
+// 反复覆盖同一批键：压缩只回收垃圾，不丢弃有效记录
+TEST_F(TieredCacheTest, FileTierReclaimsGarbage) {
+    FileTier<int, int> tier(path, 4096);
+    for (int round = 0; round < 500; ++round) {
+        for (int key = 0; key < 10; ++key)
+            ASSERT_TRUE(tier.Put(key, round));
+    }
+
+    EXPECT_GT(tier.Compactions(), 0);
+    EXPECT_EQ(tier.Dropped(), 0);
+    EXPECT_EQ(tier.Size(), 10);
+    for (int key = 0; key < 10; ++key)
+        EXPECT_EQ(tier.Get(key), 499);
+}
+
+// 大于整个文件的记录不写入，且该键的旧记录失效
+TEST_F(TieredCacheTest, FileTierRejectsOversize) {
+    FileTier<int, std::string> tier(path, 256);
+    EXPECT_TRUE(tier.Put(1, "small"));
+    EXPECT_FALSE(tier.Put(1, std::string(1000, 'x')));
+    EXPECT_FALSE(tier.Get(1).has_value());
+    EXPECT_EQ(tier.LiveBytes(), 0);
+}
+
+// 文件内容损坏时当作未命中
+TEST_F(TieredCacheTest, FileTierDetectsCorruption) {
+    FileTier<int, std::string> tier(path, 4096);
+    ASSERT_TRUE(tier.Put(1, "payload"));
+
+    // 映射是共享的，通过文件写入的修改在映射区中可见
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(30);
+        file.put('#');
+    }
+    EXPECT_FALSE(tier.Get(1).has_value());
+}
+
+// 无法创建文件时文件层不可用
+TEST_F(TieredCacheTest, FileTierUnavailable) {
+    FileTier<int, int> tier((dir / "missing" / "tier.log").string(), 4096);
+    EXPECT_FALSE(tier.IsOpen());
+    EXPECT_FALSE(tier.Put(1, 10));
+    EXPECT_FALSE(tier.Get(1).has_value());
+}
+
+// 内存层淘汰的条目写入文件层，再次访问时不经过数据源
+TEST_F(TieredCacheTest, EvictionsSpillToFile) {
+    TieredCache<int, int> cache(2, CountingSource(), Options());
+    ASSERT_TRUE(cache.FileTierOpen());
+
+    for (int key = 1; key <= 5; ++key)
+        cache.CacheLookup(key);
+    cache.Flush();
+    EXPECT_EQ(cache.Size(), 2);
+    EXPECT_EQ(cache.FileSize(), 3);
+
+    EXPECT_EQ(cache.CacheLookup(1), 10);
+    EXPECT_EQ(cache.CacheLookup(2), 20);
+    EXPECT_EQ(loads, 5);
+    EXPECT_EQ(cache.FileHits(), 2);
+    EXPECT_EQ(cache.FileMisses(), 5);
+
+    // 两层都没有的键才调用数据源
+    EXPECT_EQ(cache.CacheLookup(6), 60);
+    EXPECT_EQ(loads, 6);
+}
+
+// 工作集大于内存层但小于文件层：第二轮访问全部由两层缓存提供
+TEST_F(TieredCacheTest, WorkingSetLargerThanMemory) {
+    TieredCacheOptions<int, std::string> options;
+    options.path = path;
+    TieredCache<int, std::string> cache(16, [this](const int &key) {
+        loads.fetch_add(1);
+        return std::string(100, static_cast<char>('a' + key % 26));
+    }, options);
+
+    for (int key = 0; key < 1000; ++key)
+        cache.CacheLookup(key);
+    cache.Flush();
+
+    // 最后 16 个键仍在内存层，其余的都在文件层
+    for (int key = 0; key < 1000 - 16; ++key)
+        ASSERT_EQ(cache.CacheLookup(key), std::string(100, static_cast<char>('a' + key % 26)));
+    EXPECT_EQ(loads, 1000);
+    EXPECT_EQ(cache.FileHits(), 1000 - 16);
+    EXPECT_EQ(cache.DroppedWrites(), 0);
+}
+
+// 用户设置的 on_evict 仍然被调用
+TEST_F(TieredCacheTest, ChainsUserOnEvict) {
+    std::vector<int> evicted;
+    TieredCacheOptions<int, int> options = Options();
+    options.memory.on_evict = [&evicted](const int &key, const int &) { evicted.push_back(key); };
+
+    TieredCache<int, int> cache(1, CountingSource(), options);
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    cache.CacheLookup(3);
+    cache.Flush();
+
+    EXPECT_EQ(evicted, (std::vector<int>{1, 2}));
+    EXPECT_EQ(cache.FileSize(), 2);
+}
+
+// 文件层：写入期限随记录保存，过期的记录当作未命中
+TEST_F(TieredCacheTest, FileTierHonorsDeadline) {
+    using Clock = FileTier<int, int>::Clock;
+    FileTier<int, int> tier(path, 4096);
+    Clock::time_point start{};
+    ASSERT_TRUE(tier.Put(1, 10, start + std::chrono::seconds(5)));
+    ASSERT_TRUE(tier.Put(2, 20));
+
+    Clock::time_point deadline;
+    EXPECT_EQ(tier.Get(1, start + std::chrono::seconds(4), deadline), 10);
+    EXPECT_EQ(deadline, start + std::chrono::seconds(5));
+    EXPECT_FALSE(tier.Get(1, start + std::chrono::seconds(5), deadline).has_value());
+    EXPECT_EQ(tier.Get(2, start + std::chrono::hours(24), deadline), 20);
+    EXPECT_EQ(deadline, Clock::time_point::max());
+}
+
+// 写入后过期：文件层中过期的记录不再返回，只能从数据源重新加载
+TEST_F(TieredCacheTest, ExpiredRecordsMiss) {
+    std::chrono::steady_clock::time_point now{};
+    TieredCacheOptions<int, int> options = Options();
+    options.memory.expire_after_write = std::chrono::seconds(1);
+    options.memory.now = [&now]() { return now; };
+
+    TieredCache<int, int> cache(1, CountingSource(), options);
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    cache.Flush();
+    EXPECT_EQ(cache.FileSize(), 1);
+
+    now += std::chrono::seconds(60);
+    EXPECT_EQ(cache.CacheLookup(1), 10);
+    EXPECT_EQ(loads, 3);
+    EXPECT_EQ(cache.FileHits(), 0);
+}
+
+// 从文件层放回内存层的条目沿用原来的写入期限，不因经过文件层而续期
+TEST_F(TieredCacheTest, FileHitKeepsDeadline) {
+    std::chrono::steady_clock::time_point now{};
+    TieredCacheOptions<int, int> options = Options();
+    options.memory.expire_after_write = std::chrono::seconds(10);
+    options.memory.now = [&now]() { return now; };
+
+    TieredCache<int, int> cache(1, CountingSource(), options);
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    cache.Flush();
+
+    now += std::chrono::seconds(5);
+    EXPECT_EQ(cache.CacheLookup(1), 10);
+    EXPECT_EQ(cache.FileHits(), 1);
+    EXPECT_EQ(loads, 2);
+
+    // 加载 1 之后第 11 秒：按原期限已经过期，内存层与文件层都不再返回
+    now += std::chrono::seconds(6);
+    EXPECT_EQ(cache.CacheLookup(1), 10);
+    EXPECT_EQ(loads, 3);
+}
+
+// 淘汰时已经过期的条目不写入文件层
+TEST_F(TieredCacheTest, ExpiredVictimsNotSpilled) {
+    std::chrono::steady_clock::time_point now{};
+    std::vector<int> evicted;
+    TieredCacheOptions<int, int> options = Options();
+    options.memory.expire_after_write = std::chrono::seconds(1);
+    options.memory.now = [&now]() { return now; };
+    options.memory.on_evict = [&evicted](const int &key, const int &) { evicted.push_back(key); };
+
+    TieredCache<int, int> cache(1, CountingSource(), options);
+    cache.CacheLookup(1);
+    now += std::chrono::seconds(2);
+    cache.CacheLookup(2);
+    cache.CacheLookup(3);
+    cache.Flush();
+
+    EXPECT_EQ(evicted, (std::vector<int>{2}));
+    EXPECT_EQ(cache.FileSize(), 1);
+}
+
+// 文件层不可用时退化为单层缓存
+TEST_F(TieredCacheTest, WorksWithoutFileTier) {
+    TieredCacheOptions<int, int> options = Options();
+    options.path = (dir / "missing" / "tier.log").string();
+
+    TieredCache<int, int> cache(2, CountingSource(), options);
+    EXPECT_FALSE(cache.FileTierOpen());
+
+    for (int key = 1; key <= 3; ++key)
+        cache.CacheLookup(key);
+    cache.Flush();
+    EXPECT_EQ(cache.CacheLookup(1), 10);
+    EXPECT_EQ(loads, 4);
+}
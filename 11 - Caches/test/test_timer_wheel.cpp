@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include "../include/TimerWheel/TimerWheel.hpp"
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+class TimerWheelTest : public ::testing::Test {
+protected:
+    using Clock = std::chrono::steady_clock;
+
+    // 1 毫秒一个刻度，时间从 0 开始
+    TimerWheel<int> wheel{1ms, Clock::time_point{}};
+
+    std::vector<std::unique_ptr<TimerNode<int>>> nodes;
+
+    TimerNode<int> *Add(int key, Clock::duration after) {
+        nodes.push_back(std::make_unique<TimerNode<int>>(key));
+        TimerNode<int> *node = nodes.back().get();
+        node->expires_at = Clock::time_point{} + after;
+        wheel.Schedule(node);
+        return node;
+    }
+
+    std::vector<int> AdvanceTo(Clock::duration now) {
+        std::vector<int> expired;
+        wheel.Advance(Clock::time_point{} + now, [&expired](TimerNode<int> *node) {
+            expired.push_back(node->key);
+        });
+        return expired;
+    }
+};
+
+// 到期时间之前不触发，到达后触发一次
+TEST_F(TimerWheelTest, FiresAtDeadline) {
+    Add(1, 10ms);
+    EXPECT_TRUE(AdvanceTo(9ms).empty());
+    EXPECT_EQ(AdvanceTo(10ms), std::vector<int>{1});
+    EXPECT_TRUE(AdvanceTo(100ms).empty());
+    EXPECT_EQ(wheel.Size(), 0);
+}
+
+// 取消后不再触发
+TEST_F(TimerWheelTest, Cancel) {
+    TimerNode<int> *node = Add(1, 10ms);
+    Add(2, 10ms);
+    wheel.Cancel(node);
+    EXPECT_EQ(wheel.Size(), 1);
+    EXPECT_EQ(AdvanceTo(20ms), std::vector<int>{2});
+
+    // 重复取消是安全的
+    wheel.Cancel(node);
+    EXPECT_EQ(wheel.Size(), 0);
+}
+
+// 重新调度即推迟到期时间
+TEST_F(TimerWheelTest, Reschedule) {
+    TimerNode<int> *node = Add(1, 10ms);
+    node->expires_at = Clock::time_point{} + 5000ms;
+    wheel.Schedule(node);
+    EXPECT_EQ(wheel.Size(), 1);
+
+    EXPECT_TRUE(AdvanceTo(4999ms).empty());
+    EXPECT_EQ(AdvanceTo(5000ms), std::vector<int>{1});
+}
+
+// 已过期的定时器在下一次推进时触发
+TEST_F(TimerWheelTest, PastDeadline) {
+    AdvanceTo(50ms);
+    Add(1, 10ms);
+    EXPECT_EQ(AdvanceTo(51ms), std::vector<int>{1});
+}
+
+// 跨越各层（包括超出时间轮范围）的定时器按时触发
+TEST_F(TimerWheelTest, CascadesAcrossLevels) {
+    const std::vector<Clock::duration> deadlines = {
+        63ms, 64ms, 4095ms, 4096ms, 262143ms, 262144ms, 16777216ms, 20000000ms
+    };
+    for (size_t i = 0; i < deadlines.size(); ++i)
+        Add(static_cast<int>(i), deadlines[i]);
+
+    for (size_t i = 0; i < deadlines.size(); ++i) {
+        EXPECT_TRUE(AdvanceTo(deadlines[i] - 1ms).empty()) << i;
+        EXPECT_EQ(AdvanceTo(deadlines[i]), std::vector<int>{static_cast<int>(i)}) << i;
+    }
+}
+
+// 随机的到期时间与推进步长：每个定时器恰好在第一次越过到期时间的推进中触发
+TEST_F(TimerWheelTest, RandomizedDeadlines) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> deadline_dist(1, 300000);
+    std::uniform_int_distribution<int> step_dist(1, 5000);
+
+    std::vector<int> deadlines;
+    for (int key = 0; key < 2000; ++key) {
+        deadlines.push_back(deadline_dist(rng));
+        Add(key, std::chrono::milliseconds(deadlines.back()));
+    }
+
+    int previous = 0;
+    int fired = 0;
+    while (wheel.Size() > 0) {
+        int now = previous + step_dist(rng);
+        for (int key: AdvanceTo(std::chrono::milliseconds(now))) {
+            EXPECT_GT(deadlines[key], previous);
+            EXPECT_LE(deadlines[key], now);
+            fired = fired + 1;
+        }
+        previous = now;
+    }
+    EXPECT_EQ(fired, 2000);
+}
+
+// 刻度大于 1 时，到期时间向上取整到刻度
+TEST_F(TimerWheelTest, CoarseTick) {
+    TimerWheel<int> coarse(1s, Clock::time_point{});
+    TimerNode<int> node(1);
+    node.expires_at = Clock::time_point{} + 1500ms;
+    coarse.Schedule(&node);
+
+    int fired = 0;
+    auto count = [&fired](TimerNode<int> *) { fired = fired + 1; };
+    coarse.Advance(Clock::time_point{} + 1999ms, count);
+    EXPECT_EQ(fired, 0);
+    coarse.Advance(Clock::time_point{} + 2s, count);
+    EXPECT_EQ(fired, 1);
+}
+
+// 长时间空闲后的推进直接跳到下一个非空槽：1 毫秒刻度下跨越 100 天（约 86 亿个刻度）
+TEST_F(TimerWheelTest, SkipsIdleTicks) {
+    using days = std::chrono::hours;
+    for (int key = 1; key <= 10; ++key)
+        Add(key, days(24 * 10 * key) + std::chrono::milliseconds(key));
+    TimerNode<int> *cancelled = Add(0, days(24 * 15));
+    wheel.Cancel(cancelled);
+
+    auto begin = Clock::now();
+    std::vector<int> fired;
+    for (int day = 1; day <= 100; ++day) {
+        for (int key: AdvanceTo(days(24 * day) + 50ms))
+            fired.push_back(key);
+        EXPECT_EQ(fired.size(), static_cast<size_t>(day / 10)) << day;
+    }
+    EXPECT_EQ(fired, (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+    EXPECT_LT(Clock::now() - begin, 1s);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "../include/TinyLFU/TinyLFUCache.hpp"
+#include "LRUCacheTest.hpp"
+#include <string>
+#include <vector>
+
+class FrequencySketchTest : public ::testing::Test {
+protected:
+    FrequencySketch<int> sketch{1000};
+};
+
+// 第一次访问只记录在门卫中
+TEST_F(FrequencySketchTest, DoorkeeperFirst) {
+    EXPECT_EQ(sketch.Frequency(42), 0);
+    sketch.Increment(42);
+    EXPECT_EQ(sketch.Frequency(42), 1);
+    sketch.Increment(42);
+    EXPECT_EQ(sketch.Frequency(42), 2);
+}
+
+// 计数器上限为 15（再加门卫的 1）
+TEST_F(FrequencySketchTest, Saturates) {
+    for (int i = 0; i < 100; ++i)
+        sketch.Increment(7);
+    EXPECT_EQ(sketch.Frequency(7), 16);
+}
+
+// 热键的估计频率高于冷键
+TEST_F(FrequencySketchTest, HotBeatsCold) {
+    for (int round = 0; round < 8; ++round) {
+        for (int key = 0; key < 10; ++key)
+            sketch.Increment(key);
+    }
+    for (int key = 100; key < 600; ++key)
+        sketch.Increment(key);
+
+    for (int key = 0; key < 10; ++key)
+        EXPECT_GT(sketch.Frequency(key), sketch.Frequency(100 + key));
+}
+
+// 达到采样周期后计数器减半
+TEST_F(FrequencySketchTest, Aging) {
+    FrequencySketch<int> small(10);
+    for (int i = 0; i < 9; ++i)
+        small.Increment(1);
+    size_t before = small.Frequency(1);
+    EXPECT_EQ(before, 9);
+
+    // 采样周期为 10 * 容量 = 100 次
+    for (int key = 1000; key < 1091; ++key)
+        small.Increment(key);
+    EXPECT_LT(small.Frequency(1), before);
+}
+
+class TinyLFUCacheTest : public LRUCacheTest {};
+
+// 基本操作测试
+TEST_F(TinyLFUCacheTest, BasicLookup) {
+    TinyLFUCache<int, int> cache(10, CountingSource());
+    EXPECT_EQ(cache.CacheLookup(1), 10);
+    EXPECT_EQ(cache.CacheLookup(1), 10);
+    EXPECT_EQ(loads, 1);
+    EXPECT_TRUE(cache.Contains(1));
+    EXPECT_FALSE(cache.Contains(2));
+}
+
+// 条目数不超过容量
+TEST_F(TinyLFUCacheTest, CapacityBound) {
+    TinyLFUCache<int, int> cache(50, CountingSource());
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_EQ(cache.CacheLookup(i % 300), (i % 300) * 10);
+    EXPECT_LE(cache.Size(), 50);
+}
+
+// 一次性扫描无法挤掉热点数据
+TEST_F(TinyLFUCacheTest, ScanResistance) {
+    TinyLFUCache<int, int> cache(100, CountingSource());
+
+    for (int round = 0; round < 10; ++round) {
+        for (int key = 0; key < 50; ++key)
+            cache.CacheLookup(key);
+    }
+
+    for (int key = 1000; key < 5000; ++key)
+        cache.CacheLookup(key);
+
+    loads = 0;
+    for (int key = 0; key < 50; ++key)
+        cache.CacheLookup(key);
+    EXPECT_LE(loads, 2);
+}
+
+// 容量为1时只有窗口区
+TEST_F(TinyLFUCacheTest, SingleCapacity) {
+    TinyLFUCache<int, int> cache(1, CountingSource());
+    cache.CacheLookup(1);
+    cache.CacheLookup(2);
+    EXPECT_EQ(cache.Size(), 1);
+    EXPECT_TRUE(cache.Contains(2));
+    EXPECT_EQ(cache.CacheLookup(1), 10);
+    EXPECT_EQ(loads, 3);
+}
+
+// 容量为0时不缓存任何数据
+TEST_F(TinyLFUCacheTest, ZeroCapacity) {
+    TinyLFUCache<int, int> cache(0, CountingSource());
+    cache.CacheLookup(1);
+    cache.CacheLookup(1);
+    EXPECT_EQ(loads, 2);
+    EXPECT_EQ(cache.Size(), 0);
+}
+
+// 字符串类型缓存测试
+TEST_F(TinyLFUCacheTest, StringCache) {
+    TinyLFUCache<std::string, std::string> cache(4, [](const std::string &key) {
+        return "value_" + key;
+    });
+    EXPECT_EQ(cache.CacheLookup("key1"), "value_key1");
+    EXPECT_EQ(cache.CacheLookup("key1"), "value_key1");
+    EXPECT_TRUE(cache.Contains("key1"));
+}
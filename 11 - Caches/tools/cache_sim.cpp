@@ -0,0 +1,248 @@
+/*
+ * 缓存轨迹回放工具：
+ * 1. 一次遍历轨迹，用栈距离计算 LRU 的完整未命中率曲线（可选 SHARDS 采样）
+ * 2. 再遍历一次轨迹回放：每次解码一块键，依次交给每种缓存实现、每个容量的缓存，
+ *    只对 CacheLookup 计时，解码与读文件的开销不计入吞吐量；所有缓存同时存在，内存占用是它们容量之和
+ * 未指定 --sizes 时，按曲线估计的不同键个数选取一组容量
+ *
+ * 用法：
+ *   cache_sim <trace> [--binary] [--sizes 1000,10000] [--sample 0.01]
+ *             [--policies lru,slru,arc,clock,tinylfu] [--points 16]
+ *
+ */
+
+#include "LRU/LRUCache.hpp"
+#include "Policy/SLRUPolicy.hpp"
+#include "Policy/ARCPolicy.hpp"
+#include "CLOCK/ClockCache.hpp"
+#include "TinyLFU/TinyLFUCache.hpp"
+#include "Simulator/MissRatioCurve.hpp"
+#include "Simulator/TraceReader.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Options {
+        std::string path;
+        TraceFormat format = TraceFormat::Text;
+        std::vector<size_t> sizes;
+        double sample = 1.0;
+        std::vector<std::string> policies = {"lru", "slru", "arc", "clock", "tinylfu"};
+        size_t points = 16;
+    };
+
+    struct ReplayResult {
+        uint64_t lookups = 0;
+        uint64_t misses = 0;
+        double seconds = 0.0;
+    };
+
+    // 一种缓存实现在一个容量下的回放：feed 接收一块键并累计结果
+    struct Replay {
+        std::string policy;
+        size_t size = 0;
+        ReplayResult result;
+        std::function<void(std::span<const uint64_t>)> feed;
+    };
+
+    // 每次解码的键数
+    constexpr size_t CHUNK_KEYS = 64 * 1024;
+
+    void PrintUsage() {
+        std::fprintf(stderr,
+                     "usage: cache_sim <trace> [--binary] [--sizes N,N,...] [--sample RATE]\n"
+                     "                 [--policies lru,slru,arc,clock,tinylfu] [--points N]\n");
+    }
+
+    std::vector<std::string> Split(const std::string &text) {
+        std::vector<std::string> parts;
+        std::stringstream stream(text);
+        std::string part;
+        while (std::getline(stream, part, ','))
+            if (!part.empty())
+                parts.push_back(part);
+        return parts;
+    }
+
+    bool ParseArgs(int argc, char **argv, Options &options) {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            bool has_value = i + 1 < argc;
+
+            if (arg == "--binary") {
+                options.format = TraceFormat::Binary;
+            } else if (arg == "--sizes" && has_value) {
+                for (const auto &size: Split(argv[++i]))
+                    options.sizes.push_back(std::strtoull(size.c_str(), nullptr, 10));
+            } else if (arg == "--sample" && has_value) {
+                options.sample = std::strtod(argv[++i], nullptr);
+            } else if (arg == "--policies" && has_value) {
+                options.policies = Split(argv[++i]);
+            } else if (arg == "--points" && has_value) {
+                options.points = std::strtoull(argv[++i], nullptr, 10);
+            } else if (!arg.empty() && arg[0] != '-' && options.path.empty()) {
+                options.path = arg;
+            } else {
+                return false;
+            }
+        }
+
+        return !options.path.empty();
+    }
+
+    // 容量按几何级数分布在 [1, max_size] 上
+    std::vector<size_t> GeometricSizes(size_t max_size, size_t points) {
+        std::vector<size_t> sizes;
+        if (max_size == 0 || points == 0)
+            return sizes;
+
+        double step = 1.0;
+        if (points > 1)
+            step = std::pow(static_cast<double>(max_size), 1.0 / static_cast<double>(points - 1));
+        double size = 1.0;
+        for (size_t i = 0; i < points; ++i) {
+            auto rounded = static_cast<size_t>(size + 0.5);
+            if (sizes.empty() || rounded > sizes.back())
+                sizes.push_back(rounded);
+            size = size * step;
+        }
+        if (sizes.back() < max_size)
+            sizes.push_back(max_size);
+
+        return sizes;
+    }
+
+    template<typename Cache>
+    std::unique_ptr<Replay> MakeReplay(const std::string &policy, size_t size) {
+        auto replay = std::make_unique<Replay>();
+        replay->policy = policy;
+        replay->size = size;
+
+        // result 的地址随 unique_ptr 固定，数据源与 feed 都直接累加到其中
+        ReplayResult *result = &replay->result;
+        auto cache = std::make_shared<Cache>(size, [result](const uint64_t &key) {
+            result->misses = result->misses + 1;
+            return key;
+        });
+
+        replay->feed = [cache, result](std::span<const uint64_t> keys) {
+            auto start = std::chrono::steady_clock::now();
+            for (uint64_t key: keys)
+                cache->CacheLookup(key);
+            auto end = std::chrono::steady_clock::now();
+
+            result->lookups = result->lookups + keys.size();
+            result->seconds = result->seconds + std::chrono::duration<double>(end - start).count();
+        };
+
+        return replay;
+    }
+
+    using ReplayFactory = std::unique_ptr<Replay> (*)(const std::string &, size_t);
+
+    ReplayFactory ReplayFor(const std::string &policy) {
+        using Key = uint64_t;
+        if (policy == "lru")
+            return MakeReplay<LRUCache<Key, Key>>;
+        if (policy == "slru")
+            return MakeReplay<LRUCache<Key, Key, SLRUPolicy<Key>>>;
+        if (policy == "arc")
+            return MakeReplay<LRUCache<Key, Key, ARCPolicy<Key>>>;
+        if (policy == "clock")
+            return MakeReplay<ClockCache<Key, Key>>;
+        if (policy == "tinylfu")
+            return MakeReplay<TinyLFUCache<Key, Key>>;
+        return nullptr;
+    }
+}
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!ParseArgs(argc, argv, options)) {
+        PrintUsage();
+        return 1;
+    }
+
+    // 1. 一次遍历计算 LRU 未命中率曲线
+    MissRatioCurve curve(options.sample);
+    {
+        TraceReader reader(options.path, options.format);
+        if (!reader.IsOpen()) {
+            std::fprintf(stderr, "cannot open trace: %s\n", options.path.c_str());
+            return 1;
+        }
+
+        uint64_t key = 0;
+        auto start = std::chrono::steady_clock::now();
+        while (reader.Next(key))
+            curve.Access(key);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::printf("trace: %s, %llu accesses, ~%zu distinct keys, sample rate %.4g (%.2f s)\n",
+                    options.path.c_str(), static_cast<unsigned long long>(curve.Accesses()),
+                    curve.DistinctKeys(), options.sample, seconds);
+    }
+
+    if (curve.Accesses() == 0) {
+        std::fprintf(stderr, "trace is empty\n");
+        return 1;
+    }
+
+    std::printf("\nLRU miss ratio curve\n%12s %10s\n", "size", "miss");
+    for (size_t size: GeometricSizes(curve.DistinctKeys(), options.points))
+        std::printf("%12zu %10.4f\n", size, curve.MissRatio(size));
+
+    // 2. 对每种缓存实现和每个容量回放
+    if (options.sizes.empty()) {
+        for (size_t divisor = 64; divisor >= 1; divisor /= 2)
+            if (curve.DistinctKeys() / divisor > 0)
+                options.sizes.push_back(curve.DistinctKeys() / divisor);
+    }
+
+    std::vector<std::unique_ptr<Replay>> replays;
+    for (const auto &policy: options.policies) {
+        ReplayFactory factory = ReplayFor(policy);
+        if (!factory) {
+            std::fprintf(stderr, "unknown policy: %s\n", policy.c_str());
+            continue;
+        }
+
+        for (size_t size: options.sizes)
+            if (size != 0)
+                replays.push_back(factory(policy, size));
+    }
+
+    // 每块键只解码一次，交给所有缓存
+    TraceReader reader(options.path, options.format);
+    std::vector<uint64_t> chunk(CHUNK_KEYS);
+    while (true) {
+        size_t count = 0;
+        while (count < chunk.size() && reader.Next(chunk[count]))
+            count = count + 1;
+        if (count == 0)
+            break;
+
+        for (auto &replay: replays)
+            replay->feed(std::span<const uint64_t>(chunk.data(), count));
+    }
+
+    std::printf("\n%-10s %12s %10s %10s %12s\n", "policy", "size", "hit", "mrc hit", "Mops/s");
+    for (const auto &replay: replays) {
+        const ReplayResult &result = replay->result;
+        double hit = 1.0 - static_cast<double>(result.misses) / static_cast<double>(result.lookups);
+        double mops = static_cast<double>(result.lookups) / result.seconds / 1e6;
+        std::printf("%-10s %12zu %10.4f %10.4f %12.2f\n",
+                    replay->policy.c_str(), replay->size, hit, 1.0 - curve.MissRatio(replay->size), mops);
+    }
+
+    return 0;
+}